@@ -12,6 +12,7 @@
 		-# Test 303 bi-color full screen image 128x128
 		-# Test 304 16 bit color image from a data array
 		-# Test 305 24 bit color image data from a data array
+		-# Test 306 "clock demo" in a 4 bit framebuffer with a shadow buffer, bytes saved to serial port
 		-# Test 601 FPS bitmap results to serial port
 		-# Test 802 Error checking bitmap functions, results to serial port
 
@@ -43,6 +44,7 @@ void Test302(void); // bi-color small image
 void Test303(void); // bi-color full screen image 128x128
 void Test304(void); // 16 bit color image from a data array
 void Test305(void); // 24 bit color image data from a data array
+void Test306(void); // "clock demo" in a 4 bit framebuffer with a shadow buffer
 void Test601(void); // FPS test optional , results to serial port
 void Test802(void); // bitmap error checking, results to serial port 
 void EndTests(void);
@@ -58,6 +60,7 @@ int main(void)
 	Test303();
 	Test304();
 	Test305();
+	Test306();
 	Test802();
 	Test601();
 	EndTests();
@@ -219,6 +222,48 @@ void Test301(void)
 	myTFT.TFTFontNum(myTFT.TFTFont_Default);
 } // end of Test 301
 
+/*!
+	@brief  Test 306 "clock demo" in a 4 bit framebuffer with a shadow buffer,
+		only the changed digits are sent each second, bytes saved to serial port
+*/
+void Test306(void)
+{
+	static uint8_t frameBuffer[128 * 128 / 2];
+	static uint8_t shadowBuffer[128 * 128 / 2];
+	static const uint16_t palette[16] = {ST7735_BLACK, ST7735_WHITE, ST7735_RED, ST7735_GREEN,
+		ST7735_BLUE, ST7735_YELLOW, ST7735_CYAN, ST7735_MAGENTA};
+	char strTime[12];
+	uint8_t Min = 59;
+	uint8_t Sec = 50;
+
+	if (myTFT.TFTsetFrameBufferIndexed(frameBuffer, sizeof(frameBuffer), 4, palette) != Display_Success ||
+		myTFT.TFTsetShadowBuffer(shadowBuffer, sizeof(shadowBuffer)) != Display_Success)
+	{
+		printf("Error Test306 1: Error setting up the framebuffer\r\n");
+		return;
+	}
+	myTFT.TFTfillScreen(ST7735_BLACK);
+	myTFT.TFTdrawFastHLine(0, 32, 127, ST7735_RED);
+	myTFT.TFTdrawFastHLine(0, 80, 127, ST7735_RED);
+	myTFT.TFTFontNum(myTFT.TFTFont_Bignum);
+	for (uint8_t i = 0; i < CLOCK_DISPLAY_TIME / 2; i++)
+	{
+		if (++Sec == 60)
+		{
+			Sec = 0;
+			Min = (Min + 1) % 60;
+		}
+		snprintf(strTime, sizeof(strTime), "%02u:%02u", Min, Sec);
+		myTFT.TFTdrawText(0, 45, strTime, ST7735_GREEN, ST7735_BLACK);
+		myTFT.TFTflush();
+		printf("Test306 bytes saved: %ld\r\n", (long)myTFT.TFTflushBytesSaved());
+		TFT_MILLISEC_DELAY(TEST_DELAY1);
+	}
+	myTFT.TFTframeBufferOff();
+	myTFT.TFTfillScreen(ST7735_BLACK);
+	myTFT.TFTFontNum(myTFT.TFTFont_Default);
+}
+
 /*!
 	@brief  Test 302 bi-color small image 20x24
 */
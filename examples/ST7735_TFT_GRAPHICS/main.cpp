@@ -11,6 +11,11 @@
 		-# Test903  Circle
 		-# Test904  Triangles
 		-# Test905  More shapes, media buttons graphic.
+		-# Test906  Media buttons graphic drawn in a framebuffer
+		-# Test907  Media buttons graphic drawn in tile mode
+		-# Test908  Ellipses and arcs, gauge graphic
+		-# Test909  Polygons, arrow and star graphic
+		-# Test910  Anti-aliased lines, circles and polygon
 */
 
 // Section ::  libraries
@@ -36,6 +41,11 @@ void Test902(void);	// rectangles
 void Test903(void);	// Circle
 void Test904(void);	// Triangles
 void Test905(void);	// More shapes, media buttons graphic.
+void Test906(void);	// Media buttons graphic drawn in a framebuffer
+void Test907(void);	// Media buttons graphic drawn in tile mode
+void Test908(void);	// Ellipses and arcs, gauge graphic
+void Test909(void);	// Polygons, arrow and star graphic
+void Test910(void);	// Anti-aliased lines, circles and polygon
 void EndTests(void);
 
 //  Section ::  MAIN loop
@@ -48,6 +58,11 @@ int main(void)
 	Test903();
 	Test904();
 	Test905();
+	Test906();
+	Test907();
+	Test908();
+	Test909();
+	Test910();
 	EndTests();
 	return 0;
 }
@@ -182,6 +197,122 @@ void Test905()
 	TFT_MILLISEC_DELAY(TEST_DELAY2);
 }
 
+/*!
+	@brief  Media buttons graphic drawn in a framebuffer, each frame sent by one TFTflush
+*/
+void Test906()
+{
+	static uint16_t frameBuffer[128 * 160];
+	char teststr1[] = "Press Play";
+	uint16_t colors[3] = {ST7735_RED, ST7735_BLUE, ST7735_GREEN};
+
+	if (myTFT.TFTsetFrameBuffer(frameBuffer, sizeof(frameBuffer) / sizeof(frameBuffer[0])) != Display_Success)
+	{
+		printf("Error Test906 1: Error in the TFTsetFrameBuffer function\r\n");
+		return;
+	}
+	myTFT.TFTfillScreen(ST7735_BLACK);
+	myTFT.TFTfillRoundRect(25, 10, 78, 60, 8, ST7735_WHITE);
+	myTFT.TFTdrawText(5, 80, teststr1, ST7735_GREEN, ST7735_BLACK, 2);
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		// Only the triangle's bounding box is sent after the first frame
+		myTFT.TFTfillTriangle(42, 20, 42, 60, 90, 40, colors[i]);
+		myTFT.TFTflush();
+		TFT_MILLISEC_DELAY(TEST_DELAY2);
+	}
+	myTFT.TFTframeBufferOff();
+	myTFT.TFTfillScreen(ST7735_BLACK);
+}
+
+/*!
+	@brief  Media buttons graphic drawn in tile mode, 2KB of tiles + 1KB display list
+*/
+void Test907()
+{
+	static uint16_t tileCache[4 * 16 * 16];
+	static uint8_t displayList[1024];
+	char teststr1[] = "Press Play";
+	uint16_t colors[3] = {ST7735_RED, ST7735_BLUE, ST7735_GREEN};
+
+	if (myTFT.TFTsetTileMode(tileCache, 4, 16, 16, displayList, sizeof(displayList)) != Display_Success)
+	{
+		printf("Error Test907 1: Error in the TFTsetTileMode function\r\n");
+		return;
+	}
+	myTFT.TFTfillScreen(ST7735_BLACK);
+	myTFT.TFTfillRoundRect(25, 10, 78, 60, 8, ST7735_WHITE);
+	myTFT.TFTdrawText(5, 80, teststr1, ST7735_GREEN, ST7735_BLACK, 2);
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		// Only the tiles under the triangle are rendered and sent after the first frame
+		myTFT.TFTfillTriangle(42, 20, 42, 60, 90, 40, colors[i]);
+		if (myTFT.TFTflush() == Display_DisplayListFull)
+			printf("Error Test907 2: display list too small for this frame\r\n");
+		TFT_MILLISEC_DELAY(TEST_DELAY2);
+	}
+	myTFT.TFTframeBufferOff();
+	myTFT.TFTfillScreen(ST7735_BLACK);
+}
+
+/*!
+	@brief  Ellipses and arcs, gauge graphic. Angles are degrees clockwise from 12 o'clock
+*/
+void Test908()
+{
+	myTFT.TFTdrawEllipse(64, 20, 50, 15, ST7735_CYAN);
+	myTFT.TFTfillEllipse(64, 20, 30, 8, ST7735_BLUE);
+	myTFT.TFTdrawArc(64, 100, 50, 225, 135, ST7735_WHITE);
+	for (int16_t value = 30; value <= 270; value += 30)
+	{
+		// Dial filled from 7:30 to value, an end past 360 wraps round
+		myTFT.TFTfillArc(64, 100, 45, 10, 225, 225 + value, ST7735_GREEN);
+		TFT_MILLISEC_DELAY(TEST_DELAY1);
+	}
+	TFT_MILLISEC_DELAY(TEST_DELAY2);
+	myTFT.TFTfillScreen(ST7735_BLACK);
+}
+
+/*!
+	@brief  Polygons, arrow and star graphic
+*/
+void Test909()
+{
+	const int16_t arrow[] = {10, 20, 70, 20, 70, 5, 110, 35, 70, 65, 70, 50, 10, 50};
+	const int16_t star[] = {64, 80, 82, 140, 34, 102, 94, 102, 46, 140};
+	// Needle vertices in 1/16 pixel units, fracBits = 4
+	const int16_t needle[] = {8 * 16, 150 * 16, 120 * 16 + 8, 120 * 16 + 4, 121 * 16, 122 * 16 + 12, 9 * 16, 153 * 16};
+
+	myTFT.TFTfillPolygon(arrow, 7, ST7735_YELLOW);
+	TFT_MILLISEC_DELAY(TEST_DELAY1);
+	// Even-odd leaves the middle of the star empty, non-zero fills it
+	myTFT.TFTfillPolygon(star, 5, ST7735_RED, myTFT.TFTFill_EvenOdd);
+	TFT_MILLISEC_DELAY(TEST_DELAY2);
+	myTFT.TFTfillPolygon(star, 5, ST7735_GREEN, myTFT.TFTFill_NonZero);
+	myTFT.TFTfillPolygon(needle, 4, ST7735_CYAN, myTFT.TFTFill_EvenOdd, 4);
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+	myTFT.TFTfillScreen(ST7735_BLACK);
+}
+
+/*!
+	@brief  Anti-aliased lines, circles and polygon, blended against the black background
+*/
+void Test910()
+{
+	const int16_t needle[] = {64 * 16, 150 * 16, 20 * 16 + 8, 110 * 16 + 4, 70 * 16, 143 * 16 + 12};
+
+	for (int16_t x = 0; x < 128; x += 16)
+	{
+		myTFT.TFTdrawLine(x, 0, x + 40, 35, ST7735_WHITE);
+		myTFT.TFTdrawLineAA(x, 40, x + 40, 75, ST7735_WHITE, ST7735_BLACK);
+	}
+	myTFT.TFTdrawCircleAA(32, 100, 20, ST7735_YELLOW, ST7735_BLACK);
+	myTFT.TFTfillCircleAA(96, 100, 20, ST7735_YELLOW, ST7735_BLACK);
+	myTFT.TFTfillPolygonAA(needle, 3, ST7735_CYAN, ST7735_BLACK, myTFT.TFTFill_EvenOdd, 4);
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+	myTFT.TFTfillScreen(ST7735_BLACK);
+}
+
 /*!
 	@brief  Stop testing and shutdown the TFT
 */
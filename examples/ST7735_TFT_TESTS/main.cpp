@@ -18,6 +18,7 @@
 	-# Test 705 print method all fonts
 	-# Test 706 Misc print class tests (string object, println invert, wrap, base nums etc)
 	-# Test 707 Misc draw functions (Invert, wrap)
+	-# Test 708 Proportional font with kerning
 	-# Test 808 Error check text functions (results to serial port, 38400 baud)
 */
 
@@ -48,6 +49,8 @@ void Test704(void);
 void Test705(void);
 void Test706(void);
 void Test707(void);
+void Test708(void);
+void Test709(void);
 void Test808(void);
 void EndTests(void);
 void DisplayReset(void);
@@ -64,6 +67,8 @@ int main(void)
 	Test705();
 	Test706();
 	Test707();
+	Test708();
+	Test709();
 	Test808();
 	EndTests();
 	return 0;
@@ -485,6 +490,60 @@ void Test707(void)
 	DisplayReset();
 }
 
+/*!
+	@brief Test 708: Proportional font with kerning, TFTsetFont, RLE and anti-aliased big numbers
+*/
+void Test708(void)
+{
+	printf("Test 708: Proportional font with kerning\r\n");
+	char teststr1[] = "Fixed: To Type, Wave";
+	char teststr2[] = "Prop: To Type, Wave";
+	char teststr3[] = "The quick brown fox jumps over the lazy dog";
+	char teststr4[] = "12:45";
+
+	myTFT.TFTFontNum(myTFT.TFTFont_Default);
+	myTFT.TFTdrawText(2, 5, teststr1, ST7735_WHITE, ST7735_BLACK, 1);
+	myTFT.TFTsetFont(&TFTFontPropDefault);
+	myTFT.TFTdrawText(2, 15, teststr2, ST7735_WHITE, ST7735_BLACK);
+	myTFT.TFTdrawText(2, 35, teststr3, ST7735_YELLOW, ST7735_BLUE);
+	myTFT.TFTdrawText(2, 75, teststr3, ST7735_GREEN, ST7735_GREEN);
+
+	myTFT.setTextColor(ST7735_CYAN, ST7735_BLACK);
+	myTFT.TFTsetCursor(2, 115);
+	myTFT.print("Width: ");
+	myTFT.print(myTFT.TFTtextWidth(teststr3));
+	myTFT.TFTsetFont(&TFTFontPropBigNum);
+	myTFT.TFTdrawText(2, 126, teststr4, ST7735_RED, ST7735_BLACK);
+	myTFT.TFTsetFont(&TFTFontPropBigNumAA);
+	myTFT.TFTdrawText(86, 134, teststr4, ST7735_YELLOW, ST7735_BLACK);
+	myTFT.TFTFontNum(myTFT.TFTFont_Default);
+	DisplayReset();
+}
+
+/*!
+	@brief Test 709: UTF-8 text, accented Latin, Greek and symbols in the proportional font
+*/
+void Test709(void)
+{
+	printf("Test 709: UTF-8 text\r\n");
+	char teststr1[] = "Temp: 23.5°C ±0.1";
+	char teststr2[] = "Ω 47k  µs  ½ ¼";
+	char teststr3[] = "α δ ε π Σ σ τ Φ Θ";
+	char teststr4[] = "Größe, café, año";
+
+	myTFT.TFTsetFont(&TFTFontPropDefault);
+	myTFT.TFTdrawText(2, 5, teststr1, ST7735_WHITE, ST7735_BLACK);
+	myTFT.TFTdrawText(2, 20, teststr2, ST7735_YELLOW, ST7735_BLACK);
+	myTFT.TFTdrawText(2, 35, teststr3, ST7735_CYAN, ST7735_BLACK);
+	myTFT.TFTdrawText(2, 50, teststr4, ST7735_GREEN, ST7735_GREEN);
+
+	myTFT.setTextColor(ST7735_RED, ST7735_BLACK);
+	myTFT.TFTsetCursor(2, 70);
+	myTFT.print("≤ 5V  ≥ 2V  √2  ∞");
+	myTFT.TFTFontNum(myTFT.TFTFont_Default);
+	DisplayReset();
+}
+
 /*!
 	@brief Test 808: Error checking 
 */
@@ -0,0 +1,850 @@
+/*!
+	@file     st7735_fontc.cpp
+	@author   Gavin Lyons
+	@brief    Host font compiler for ST7735_TFT_PICO. Converts BDF and PCF bitmap fonts
+			  into a header of font data in the library's own formats, see ST7735_TFT_Font.hpp.
+	@details
+		-# Row layout, TFT_PropFont_t: proportional, each glyph cropped to its set pixels,
+			one bit per pixel, RLE or 2/4 bit anti-aliased. Selected with TFTsetFont.
+		-# Column layout, TFT_Font_t TFTFontLayout_Column: fixed width cells like fonts 7-12.
+			Added with TFTFontRegister.
+		Only the characters asked for are kept. A report of flash and SPI cost per glyph
+		goes to stderr.
+	@note Build on Linux: cmake -S extra/fontcompiler -B build && cmake --build build
+*/
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+/*! One glyph, pixels row by row, 1 = set, or a coverage level when anti-aliased */
+struct Glyph_t
+{
+	uint32_t code = 0;			 /**< Character code */
+	int width = 0;				 /**< Box width */
+	int height = 0;				 /**< Box height */
+	int xOffset = 0;			 /**< Origin to box left */
+	int top = 0;				 /**< Line top to box top, baseline at font ascent */
+	int advance = 0;			 /**< Origin to next origin */
+	std::vector<uint8_t> pixels; /**< width * height */
+};
+
+/*! A parsed font */
+struct Font_t
+{
+	int ascent = 0;						/**< Pixels above the baseline */
+	int descent = 0;					/**< Pixels below the baseline */
+	std::map<uint32_t, Glyph_t> glyphs; /**< By character code */
+};
+
+/*! What to make */
+struct Options_t
+{
+	std::string input;			/**< BDF or PCF file */
+	std::string output;			/**< Header file, stdout if empty */
+	std::string name;			/**< C identifier of the font */
+	std::vector<bool> keep;		/**< Code points 0-0xFFFF to keep */
+	bool subset = false;		/**< keep was set by -c or -r */
+	bool columnLayout = false;	/**< TFT_Font_t column layout, else TFT_PropFont_t rows */
+	bool rle = false;			/**< RLE glyphs, row layout only */
+	int bpp = 1;				/**< Bits per pixel, 2 or 4 anti-aliased, row layout only */
+	int scale = 2;				/**< Anti-aliased: the font is shrunk by this, each pixel covers scale x scale */
+};
+
+static void usage(void)
+{
+	fprintf(stderr,
+			"Usage: st7735_fontc [options] font.bdf|font.pcf\n"
+			"  -o file     output header, default stdout\n"
+			"  -n name     C name of the font, default from the file name\n"
+			"  -c chars    keep these characters, UTF-8, e.g. -c \"0123456789:.-°\"\n"
+			"  -r ranges   keep these code points, e.g. -r 0x20-0x7E,0xB0,0x391-0x3C9\n"
+			"  -l row      TFT_PropFont_t, proportional, for TFTsetFont (default)\n"
+			"  -l column   TFT_Font_t fixed width column layout, for TFTFontRegister\n"
+			"  -z          RLE compress the glyphs (row layout)\n"
+			"  -a 2|4      anti-aliased, 2 or 4 bits of coverage per pixel (row layout)\n"
+			"  -s scale    with -a the font is shrunk by scale, default 2, draw it scale times larger\n"
+			"Code points above 0xFF go in the font's sparse index (row layout), those above\n"
+			"0xFFFF are skipped. Without -c or -r every glyph 0-0xFF is kept.\n");
+}
+
+// ******** Parsing ********
+
+/*!
+	@brief Value of one hex digit
+	@return 0-15, -1 if c is not a hex digit
+*/
+static int hexDigit(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return -1;
+}
+
+static bool bdfParse(const std::string &path, Font_t &font)
+{
+	std::ifstream file(path);
+	if (!file)
+		return false;
+	std::string line;
+	Glyph_t glyph;
+	bool inGlyph = false;
+	int boxAscent = 0, boxDescent = 0, glyphYOffset = 0;
+	int bitmapRows = -1;
+	int lineNumber = 0;
+	while (std::getline(file, line))
+	{
+		lineNumber++;
+		std::istringstream words(line);
+		std::string key;
+		words >> key;
+		if (bitmapRows >= 0 && key != "ENDCHAR")
+		{
+			// one row of hex, leftmost pixel in the top bit of the first byte
+			for (size_t digit = 0; digit < key.size(); digit++)
+			{
+				if (hexDigit(key[digit]) < 0)
+				{
+					fprintf(stderr, "Error: %s line %d, bad hex in BITMAP row \"%s\"\n", path.c_str(), lineNumber, key.c_str());
+					return false;
+				}
+			}
+			// rows past the BBX height, or with no BBX before BITMAP, have nowhere to go
+			if (bitmapRows < glyph.height)
+			{
+				for (int x = 0; x < glyph.width; x++)
+				{
+					size_t digit = x / 4;
+					int value = (digit < key.size()) ? hexDigit(key[digit]) : 0;
+					glyph.pixels[bitmapRows * glyph.width + x] = (value >> (3 - x % 4)) & 1;
+				}
+			}
+			bitmapRows++;
+			continue;
+		}
+		if (key == "FONTBOUNDINGBOX")
+		{
+			int w, h, xo, yo;
+			words >> w >> h >> xo >> yo;
+			boxAscent = h + yo;
+			boxDescent = -yo;
+		}
+		else if (key == "FONT_ASCENT")
+			words >> font.ascent;
+		else if (key == "FONT_DESCENT")
+			words >> font.descent;
+		else if (key == "STARTCHAR")
+		{
+			glyph = Glyph_t();
+			inGlyph = true;
+		}
+		else if (key == "ENCODING" && inGlyph)
+		{
+			int code;
+			words >> code;
+			glyph.code = (code < 0) ? UINT32_MAX : code;
+		}
+		else if (key == "DWIDTH" && inGlyph)
+			words >> glyph.advance;
+		else if (key == "BBX" && inGlyph)
+		{
+			words >> glyph.width >> glyph.height >> glyph.xOffset >> glyphYOffset;
+			if (!words || glyph.width < 0 || glyph.height < 0)
+			{
+				fprintf(stderr, "Error: %s line %d, bad BBX\n", path.c_str(), lineNumber);
+				return false;
+			}
+			glyph.pixels.assign(glyph.width * glyph.height, 0);
+		}
+		else if (key == "BITMAP" && inGlyph)
+			bitmapRows = 0;
+		else if (key == "ENDCHAR" && inGlyph)
+		{
+			// top is from the baseline for now, made relative to the line top once the ascent is known
+			glyph.top = -(glyphYOffset + glyph.height);
+			if (glyph.code != UINT32_MAX)
+				font.glyphs[glyph.code] = glyph;
+			inGlyph = false;
+			bitmapRows = -1;
+		}
+	}
+	if (font.ascent == 0 && font.descent == 0)
+	{
+		font.ascent = boxAscent;
+		font.descent = boxDescent;
+	}
+	for (auto &entry : font.glyphs)
+		entry.second.top += font.ascent;
+	return true;
+}
+
+#define PCF_ACCELERATORS (1 << 1)
+#define PCF_METRICS (1 << 2)
+#define PCF_BITMAPS (1 << 3)
+#define PCF_BDF_ENCODINGS (1 << 5)
+#define PCF_BDF_ACCELERATORS (1 << 8)
+#define PCF_GLYPH_PAD_MASK (3 << 0)
+#define PCF_BYTE_MASK (1 << 2)
+#define PCF_BIT_MASK (1 << 3)
+#define PCF_SCAN_UNIT_MASK (3 << 4)
+#define PCF_COMPRESSED_METRICS 0x100
+
+/*! Reads the numbers of one PCF table, in the table's byte order */
+struct PcfReader_t
+{
+	const std::vector<uint8_t> &data; /**< whole file */
+	size_t pos;						  /**< next byte */
+	bool msb;						  /**< most significant byte first */
+
+	uint32_t u32(void)
+	{
+		uint32_t value = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			uint32_t byte = (pos < data.size()) ? data[pos] : 0;
+			pos++;
+			value |= msb ? byte << (8 * (3 - i)) : byte << (8 * i);
+		}
+		return value;
+	}
+	int16_t s16(void)
+	{
+		uint16_t value = 0;
+		for (int i = 0; i < 2; i++)
+		{
+			uint16_t byte = (pos < data.size()) ? data[pos] : 0;
+			pos++;
+			value |= msb ? byte << (8 * (1 - i)) : byte << (8 * i);
+		}
+		return (int16_t)value;
+	}
+	uint8_t u8(void)
+	{
+		return (pos < data.size()) ? data[pos++] : 0;
+	}
+};
+
+static bool pcfParse(const std::string &path, Font_t &font)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		return false;
+	std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (data.size() < 8 || memcmp(data.data(), "\1fcp", 4) != 0)
+		return false;
+
+	// 1. Table of contents, always LSB first
+	PcfReader_t toc{data, 4, false};
+	uint32_t tableCount = toc.u32();
+	std::map<uint32_t, uint32_t> offsets;
+	for (uint32_t i = 0; i < tableCount; i++)
+	{
+		uint32_t type = toc.u32();
+		toc.u32(); // format, repeated at the table start
+		toc.u32(); // size
+		offsets[type] = toc.u32();
+	}
+	if (!offsets.count(PCF_METRICS) || !offsets.count(PCF_BITMAPS) || !offsets.count(PCF_BDF_ENCODINGS))
+		return false;
+	auto table = [&](uint32_t type, uint32_t &format) {
+		PcfReader_t reader{data, offsets[type], false};
+		format = reader.u32();
+		reader.msb = format & PCF_BYTE_MASK;
+		return reader;
+	};
+	uint32_t format;
+
+	// 2. Ascent and descent
+	uint32_t accelerators = offsets.count(PCF_BDF_ACCELERATORS) ? PCF_BDF_ACCELERATORS : PCF_ACCELERATORS;
+	if (offsets.count(accelerators))
+	{
+		PcfReader_t reader = table(accelerators, format);
+		reader.pos += 8; // flags
+		font.ascent = (int32_t)reader.u32();
+		font.descent = (int32_t)reader.u32();
+	}
+
+	// 3. Metrics
+	PcfReader_t metrics = table(PCF_METRICS, format);
+	bool compressed = format & PCF_COMPRESSED_METRICS;
+	uint32_t glyphCount = compressed ? (uint16_t)metrics.s16() : metrics.u32();
+	std::vector<Glyph_t> glyphs(glyphCount);
+	for (Glyph_t &glyph : glyphs)
+	{
+		int left, right, advance, ascent, descent;
+		if (compressed)
+		{
+			left = metrics.u8() - 0x80;
+			right = metrics.u8() - 0x80;
+			advance = metrics.u8() - 0x80;
+			ascent = metrics.u8() - 0x80;
+			descent = metrics.u8() - 0x80;
+		}
+		else
+		{
+			left = metrics.s16();
+			right = metrics.s16();
+			advance = metrics.s16();
+			ascent = metrics.s16();
+			descent = metrics.s16();
+			metrics.s16(); // attributes
+		}
+		glyph.width = right - left;
+		glyph.height = ascent + descent;
+		glyph.xOffset = left;
+		glyph.top = font.ascent - ascent;
+		glyph.advance = advance;
+		if (glyph.width < 0 || glyph.height < 0)
+			glyph.width = glyph.height = 0;
+	}
+
+	// 4. Bitmaps, rows padded to 1, 2, 4 or 8 bytes
+	PcfReader_t bitmaps = table(PCF_BITMAPS, format);
+	if (bitmaps.u32() != glyphCount)
+		return false;
+	std::vector<uint32_t> glyphOffsets(glyphCount);
+	for (uint32_t &offset : glyphOffsets)
+		offset = bitmaps.u32();
+	bitmaps.pos += 16; // bitmap sizes for each padding
+	size_t bitmapStart = bitmaps.pos;
+	uint32_t pad = 1u << (format & PCF_GLYPH_PAD_MASK);
+	uint32_t unit = 1u << ((format & PCF_SCAN_UNIT_MASK) >> 4);
+	bool msbBit = format & PCF_BIT_MASK;
+	bool msbByte = format & PCF_BYTE_MASK;
+	for (uint32_t i = 0; i < glyphCount; i++)
+	{
+		Glyph_t &glyph = glyphs[i];
+		uint32_t rowBytes = ((glyph.width + 8 * pad - 1) / (8 * pad)) * pad;
+		glyph.pixels.assign(glyph.width * glyph.height, 0);
+		for (int y = 0; y < glyph.height; y++)
+		{
+			for (int x = 0; x < glyph.width; x++)
+			{
+				uint32_t byte = x / 8;
+				if (!msbByte && unit > 1)
+					byte = (byte / unit) * unit + (unit - 1 - byte % unit);
+				size_t at = bitmapStart + glyphOffsets[i] + y * rowBytes + byte;
+				uint8_t value = (at < data.size()) ? data[at] : 0;
+				uint8_t mask = msbBit ? (0x80 >> (x % 8)) : (1 << (x % 8));
+				glyph.pixels[y * glyph.width + x] = (value & mask) ? 1 : 0;
+			}
+		}
+	}
+
+	// 5. Encodings, code to glyph index
+	PcfReader_t encodings = table(PCF_BDF_ENCODINGS, format);
+	int minByte2 = encodings.s16(), maxByte2 = encodings.s16();
+	int minByte1 = encodings.s16(), maxByte1 = encodings.s16();
+	encodings.s16(); // default char
+	for (int byte1 = minByte1; byte1 <= maxByte1; byte1++)
+	{
+		for (int byte2 = minByte2; byte2 <= maxByte2; byte2++)
+		{
+			uint16_t index = encodings.s16();
+			if (index == 0xFFFF || index >= glyphCount)
+				continue;
+			Glyph_t glyph = glyphs[index];
+			glyph.code = (byte1 << 8) | byte2;
+			font.glyphs[glyph.code] = glyph;
+		}
+	}
+	return true;
+}
+
+// ******** Layout ********
+
+/*! Shrink a glyph's box to its set pixels, a glyph with none gets an empty box */
+static void glyphCrop(Glyph_t &glyph)
+{
+	int left = glyph.width, right = -1, top = glyph.height, bottom = -1;
+	for (int y = 0; y < glyph.height; y++)
+	{
+		for (int x = 0; x < glyph.width; x++)
+		{
+			if (!glyph.pixels[y * glyph.width + x])
+				continue;
+			left = std::min(left, x);
+			right = std::max(right, x);
+			top = std::min(top, y);
+			bottom = std::max(bottom, y);
+		}
+	}
+	if (right < 0)
+	{
+		glyph.width = glyph.height = glyph.xOffset = glyph.top = 0;
+		glyph.pixels.clear();
+		return;
+	}
+	std::vector<uint8_t> pixels;
+	for (int y = top; y <= bottom; y++)
+		for (int x = left; x <= right; x++)
+			pixels.push_back(glyph.pixels[y * glyph.width + x]);
+	glyph.xOffset += left;
+	glyph.top += top;
+	glyph.width = right - left + 1;
+	glyph.height = bottom - top + 1;
+	glyph.pixels = pixels;
+}
+
+/*! bpp bits per pixel MSB first, row by row with no padding */
+static std::vector<uint8_t> encodePacked(const Glyph_t &glyph, int bpp)
+{
+	std::vector<uint8_t> out((glyph.pixels.size() * bpp + 7) / 8, 0);
+	for (size_t i = 0; i < glyph.pixels.size(); i++)
+		out[i * bpp / 8] |= glyph.pixels[i] << (8 - bpp - i * bpp % 8);
+	return out;
+}
+
+/*! Shrink a glyph by scale, each pixel's coverage of its scale x scale source pixels
+	becomes a level 0 to 2^bpp - 1, the grid starts at the origin and the line top */
+static void glyphShrink(Glyph_t &glyph, int scale, int bpp)
+{
+	int levels = (1 << bpp) - 1;
+	auto down = [scale](int value) { return (value >= 0) ? value / scale : -((-value + scale - 1) / scale); };
+	int left = down(glyph.xOffset), top = down(glyph.top);
+	int width = (glyph.width > 0) ? down(glyph.xOffset + glyph.width - 1) - left + 1 : 0;
+	int height = (glyph.height > 0) ? down(glyph.top + glyph.height - 1) - top + 1 : 0;
+	std::vector<uint8_t> pixels(width * height, 0);
+	for (int y = 0; y < glyph.height; y++)
+		for (int x = 0; x < glyph.width; x++)
+			if (glyph.pixels[y * glyph.width + x])
+				pixels[(down(glyph.top + y) - top) * width + down(glyph.xOffset + x) - left]++;
+	for (uint8_t &pixel : pixels)
+		pixel = (pixel * levels + scale * scale / 2) / (scale * scale);
+	glyph.xOffset = left;
+	glyph.top = top;
+	glyph.width = width;
+	glyph.height = height;
+	glyph.advance = (glyph.advance + scale / 2) / scale;
+	glyph.pixels = pixels;
+}
+
+/*! Background run in the high nibble then a set run in the low nibble, 0-15 each */
+static std::vector<uint8_t> encodeRLE(const Glyph_t &glyph)
+{
+	std::vector<uint8_t> out;
+	size_t i = 0, count = glyph.pixels.size();
+	while (i < count)
+	{
+		uint8_t background = 0, set = 0;
+		while (i < count && !glyph.pixels[i] && background < 15)
+		{
+			background++;
+			i++;
+		}
+		if (background == 15 && i < count && !glyph.pixels[i])
+		{
+			out.push_back(background << 4);
+			continue;
+		}
+		while (i < count && glyph.pixels[i] && set < 15)
+		{
+			set++;
+			i++;
+		}
+		out.push_back((background << 4) | set);
+	}
+	return out;
+}
+
+/*! Runs of pixels at threshold or more, one rectangle each when drawn with bg == color */
+static int glyphRuns(const Glyph_t &glyph, int threshold = 1)
+{
+	int runs = 0;
+	for (int y = 0; y < glyph.height; y++)
+		for (int x = 0; x < glyph.width; x++)
+			if (glyph.pixels[y * glyph.width + x] >= threshold && (x == 0 || glyph.pixels[y * glyph.width + x - 1] < threshold))
+				runs++;
+	return runs;
+}
+
+/*! SPI bytes to draw a w by h window: CASET, RASET and RAMWR then 2 bytes a pixel */
+static long windowCost(long w, long h)
+{
+	return 11 + 2 * w * h;
+}
+
+static void bytesWrite(FILE *out, const std::vector<uint8_t> &bytes)
+{
+	for (size_t i = 0; i < bytes.size(); i++)
+		fprintf(out, "%s0x%02X,%s", (i % 16 == 0) ? "\t" : "", bytes[i], (i % 16 == 15 || i + 1 == bytes.size()) ? "\n" : " ");
+}
+
+static std::string charName(uint32_t code)
+{
+	char text[16];
+	if (code > 0x20 && code < 0x7F && code != '\\')
+		snprintf(text, sizeof(text), "'%c'", (char)code);
+	else if (code > 0xFF)
+		snprintf(text, sizeof(text), "U+%04X", code);
+	else
+		snprintf(text, sizeof(text), "0x%02X", code);
+	return text;
+}
+
+static bool rowLayoutWrite(FILE *out, const Options_t &options, std::vector<Glyph_t> &glyphs, int height)
+{
+	// A first to last range of codes up to 0xFF is a direct index, 8 bytes a code kept or not.
+	// The rest go in the sparse index, 10 bytes each. Pick the range that costs least.
+	size_t byteMax = 0;
+	while (byteMax < glyphs.size() && glyphs[byteMax].code <= 0xFF)
+		byteMax++;
+	size_t denseStart = 0, dense = 0;
+	long best = 10L * glyphs.size();
+	for (size_t i = 0; i < byteMax; i++)
+	{
+		for (size_t j = i; j < byteMax; j++)
+		{
+			long cost = 8L * (glyphs[j].code - glyphs[i].code + 1) + 10L * (glyphs.size() - (j - i + 1));
+			if (cost < best)
+			{
+				best = cost;
+				denseStart = i;
+				dense = j - i + 1;
+			}
+		}
+	}
+	uint32_t first = (dense > 0) ? glyphs[denseStart].code : 1, last = (dense > 0) ? glyphs[denseStart + dense - 1].code : 0;
+	std::vector<Glyph_t> sparse;
+	for (size_t i = 0; i < glyphs.size(); i++)
+		if (i < denseStart || i >= denseStart + dense)
+			sparse.push_back(glyphs[i]);
+	glyphs.erase(glyphs.begin() + denseStart + dense, glyphs.end());
+	glyphs.erase(glyphs.begin(), glyphs.begin() + denseStart);
+	glyphs.insert(glyphs.end(), sparse.begin(), sparse.end());
+	std::vector<uint32_t> codes;
+	for (uint32_t code = first; code <= last; code++)
+		codes.push_back(code);
+	for (const Glyph_t &glyph : sparse)
+		codes.push_back(glyph.code);
+	std::vector<uint8_t> bitmap;
+	std::vector<std::string> entries;
+	long bitsTotal = 0, rleTotal = 0, drawTotal = 0;
+	size_t next = 0;
+	int threshold = (1 << options.bpp) / 2; // what the library draws when there is no background to blend with
+	fprintf(stderr, "char   box     bearing adv  flash B  opaque SPI B  rects\n");
+	for (uint32_t code : codes)
+	{
+		if (glyphs[next].code != code)
+		{
+			entries.push_back("\t{0, 0, 0, 0, 0, 0}, // " + charName(code) + " not kept");
+			continue;
+		}
+		const Glyph_t &glyph = glyphs[next++];
+		if (glyph.advance > 255 || glyph.xOffset < -128 || glyph.xOffset > 127 || bitmap.size() > 0xFFFF)
+		{
+			fprintf(stderr, "Error: glyph %s does not fit TFT_Glyph_t\n", charName(code).c_str());
+			return false;
+		}
+		std::vector<uint8_t> bits = encodePacked(glyph, options.bpp), rle = encodeRLE(glyph);
+		const std::vector<uint8_t> &stored = options.rle ? rle : bits;
+		bitsTotal += bits.size();
+		rleTotal += rle.size();
+		char entry[96];
+		snprintf(entry, sizeof(entry), "\t{%zu, %d, %d, %d, %d, %d}, // %s", bitmap.size(), glyph.width, glyph.height,
+				 glyph.advance, glyph.xOffset, glyph.top, charName(code).c_str());
+		entries.push_back(entry);
+		bitmap.insert(bitmap.end(), stored.begin(), stored.end());
+		long draw = windowCost(glyph.advance, height);
+		drawTotal += draw;
+		fprintf(stderr, "%-6s %3dx%-3d %+3d%+3d  %3d  %4zu+8   %6ld        %4d\n", charName(code).c_str(), glyph.width,
+				glyph.height, glyph.xOffset, glyph.top, glyph.advance, stored.size(), draw, glyphRuns(glyph, threshold));
+	}
+	long flash = bitmap.size() + 8 * entries.size() + 2 * (glyphs.size() - dense) + 20;
+	fprintf(stderr, "%zu glyphs 0x%02X-0x%02X and %zu in the sparse index, line height %d\n", glyphs.size(), first, last,
+			glyphs.size() - dense, height);
+	if (options.bpp > 1)
+		fprintf(stderr, "flash %ld bytes: glyph data %zu (%d bits per pixel), glyph table %zu, sparse index %zu, font 20\n",
+				flash, bitmap.size(), options.bpp, 8 * entries.size(), 2 * (glyphs.size() - dense));
+	else
+		fprintf(stderr, "flash %ld bytes: glyph data %zu (bits %ld, RLE %ld), glyph table %zu, sparse index %zu, font 20\n",
+				flash, bitmap.size(), bitsTotal, rleTotal, 8 * entries.size(), 2 * (glyphs.size() - dense));
+	fprintf(stderr, "one of each glyph drawn opaque, %ld SPI bytes\n", drawTotal);
+
+	const char *name = options.name.c_str();
+	fprintf(out, "// %s: made by st7735_fontc from %s\n#pragma once\n\n#include \"st7735/ST7735_TFT_Font.hpp\"\n\n",
+			name, options.input.c_str());
+	fprintf(out, "inline constexpr uint8_t %s_Bitmap[] = {\n", name);
+	bytesWrite(out, bitmap.empty() ? std::vector<uint8_t>{0} : bitmap);
+	fprintf(out, "};\n\ninline constexpr TFT_Glyph_t %s_Glyphs[] = {\n", name);
+	for (const std::string &entry : entries)
+		fprintf(out, "%s\n", entry.c_str());
+	fprintf(out, "};\n\n");
+	if (dense < glyphs.size())
+	{
+		fprintf(out, "inline constexpr uint16_t %s_Codes[] = {\n", name);
+		for (size_t i = dense; i < glyphs.size(); i++)
+			fprintf(out, "%s0x%04X,%s", ((i - dense) % 8 == 0) ? "\t" : "", glyphs[i].code,
+					((i - dense) % 8 == 7 || i + 1 == glyphs.size()) ? "\n" : " ");
+		fprintf(out, "};\n\n");
+	}
+	fprintf(out, "// Select with TFTsetFont(&%s)\ninline constexpr TFT_PropFont_t %s = {\n", name, name);
+	const char *encoding = options.rle ? "TFTGlyph_RLE" : (options.bpp == 4) ? "TFTGlyph_Gray4" : (options.bpp == 2) ? "TFTGlyph_Gray2" : "TFTGlyph_Bits";
+	fprintf(out, "\t%s_Bitmap, %s_Glyphs, nullptr, 0, 0x%02X, 0x%02X, %d, %s", name, name, first, last, height, encoding);
+	if (dense < glyphs.size())
+		fprintf(out, ",\n\t%s_Codes, %zu", name, glyphs.size() - dense);
+	fprintf(out, "};\n");
+	return true;
+}
+
+static bool columnLayoutWrite(FILE *out, const Options_t &options, std::vector<Glyph_t> &glyphs, int height)
+{
+	uint32_t first = glyphs.front().code, last = glyphs.back().code;
+	// Every glyph in a cell as wide as the widest advance or box, none starts left of the cell
+	int shift = 0, width = 1;
+	for (const Glyph_t &glyph : glyphs)
+		if (glyph.width > 0)
+			shift = std::max(shift, -glyph.xOffset);
+	for (const Glyph_t &glyph : glyphs)
+		width = std::max({width, glyph.advance, glyph.xOffset + shift + glyph.width});
+	if (width > 255 || last - first + 1 > 255)
+	{
+		fprintf(stderr, "Error: %d wide cells of %u characters do not fit TFT_Font_t\n", width, last - first + 1);
+		return false;
+	}
+	int bytesPerColumn = (height + 7) / 8;
+	std::vector<uint8_t> data;
+	size_t next = 0;
+	long drawTotal = 0;
+	fprintf(stderr, "char   box     flash B  opaque SPI B  rects\n");
+	for (uint32_t code = first; code <= last; code++)
+	{
+		std::vector<uint8_t> cell(width * bytesPerColumn, 0);
+		if (glyphs[next].code == code)
+		{
+			const Glyph_t &glyph = glyphs[next++];
+			for (int y = 0; y < glyph.height; y++)
+			{
+				for (int x = 0; x < glyph.width; x++)
+				{
+					if (!glyph.pixels[y * glyph.width + x])
+						continue;
+					int column = glyph.xOffset + shift + x, row = glyph.top + y;
+					cell[column * bytesPerColumn + row / 8] |= 0x80 >> (row % 8);
+				}
+			}
+			drawTotal += windowCost(width, height);
+			fprintf(stderr, "%-6s %3dx%-3d  %4zu     %6ld        %4d\n", charName(code).c_str(), glyph.width,
+					glyph.height, cell.size(), windowCost(width, height), glyphRuns(glyph));
+		}
+		data.insert(data.end(), cell.begin(), cell.end());
+	}
+	fprintf(stderr, "%zu glyphs 0x%02X-0x%02X, cells %dx%d\n", glyphs.size(), first, last, width, height);
+	fprintf(stderr, "flash %zu bytes glyph data + font 12, one of each glyph drawn %ld SPI bytes\n", data.size(), drawTotal);
+
+	const char *name = options.name.c_str();
+	fprintf(out, "// %s: made by st7735_fontc from %s\n#pragma once\n\n#include \"st7735/ST7735_TFT_Font.hpp\"\n\n",
+			name, options.input.c_str());
+	fprintf(out, "inline constexpr uint8_t %s_Data[] = {\n", name);
+	bytesWrite(out, data);
+	fprintf(out, "};\n\n// Add with TFTFontRegister(TFTFont_User1, &%s)\ninline constexpr TFT_Font_t %s = {\n", name, name);
+	fprintf(out, "\t%s_Data, %d, %d, 0x%02X, %u, TFTFontLayout_Column};\n", name, width, height, first, last - first + 1);
+	return true;
+}
+
+// ******** Main ********
+
+/*! Mark the code points of a UTF-8 string */
+static bool utf8Keep(const char *text, std::vector<bool> &keep)
+{
+	const uint8_t *byte = (const uint8_t *)text;
+	while (*byte)
+	{
+		int extra = (*byte >= 0xF0) ? 3 : (*byte >= 0xE0) ? 2 : (*byte >= 0xC0) ? 1 : 0;
+		if (*byte >= 0x80 && *byte < 0xC0)
+			return false;
+		uint32_t code = *byte++ & (extra ? 0x3F >> extra : 0x7F);
+		for (int i = 0; i < extra; i++)
+		{
+			if ((*byte & 0xC0) != 0x80)
+				return false;
+			code = (code << 6) | (*byte++ & 0x3F);
+		}
+		if (code <= 0xFFFF)
+			keep[code] = true;
+	}
+	return true;
+}
+
+static bool rangesParse(const char *text, std::vector<bool> &keep)
+{
+	std::stringstream list(text);
+	std::string range;
+	while (std::getline(list, range, ','))
+	{
+		char *end;
+		unsigned long low = strtoul(range.c_str(), &end, 0), high = low;
+		if (*end == '-')
+			high = strtoul(end + 1, &end, 0);
+		if (*end != '\0' || low > high || high > 0xFFFF)
+			return false;
+		for (unsigned long code = low; code <= high; code++)
+			keep[code] = true;
+	}
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	Options_t options;
+	options.keep.assign(0x10000, false);
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "-o" && hasValue)
+			options.output = argv[++i];
+		else if (arg == "-n" && hasValue)
+			options.name = argv[++i];
+		else if (arg == "-c" && hasValue)
+		{
+			if (!utf8Keep(argv[++i], options.keep))
+			{
+				fprintf(stderr, "Error: -c %s is not UTF-8\n", argv[i]);
+				return 1;
+			}
+			options.subset = true;
+		}
+		else if (arg == "-r" && hasValue)
+		{
+			if (!rangesParse(argv[++i], options.keep))
+			{
+				fprintf(stderr, "Error: bad range list %s\n", argv[i]);
+				return 1;
+			}
+			options.subset = true;
+		}
+		else if (arg == "-l" && hasValue)
+		{
+			std::string layout = argv[++i];
+			if (layout != "row" && layout != "column")
+			{
+				usage();
+				return 1;
+			}
+			options.columnLayout = (layout == "column");
+		}
+		else if (arg == "-z")
+			options.rle = true;
+		else if (arg == "-a" && hasValue)
+		{
+			options.bpp = atoi(argv[++i]);
+			if (options.bpp != 2 && options.bpp != 4)
+			{
+				usage();
+				return 1;
+			}
+		}
+		else if (arg == "-s" && hasValue)
+		{
+			options.scale = atoi(argv[++i]);
+			if (options.scale < 1 || options.scale > 8)
+			{
+				fprintf(stderr, "Error: scale 1-8\n");
+				return 1;
+			}
+		}
+		else if (arg[0] != '-' && options.input.empty())
+			options.input = arg;
+		else
+		{
+			usage();
+			return 1;
+		}
+	}
+	if (options.input.empty())
+	{
+		usage();
+		return 1;
+	}
+	if ((options.rle || options.bpp > 1) && options.columnLayout)
+	{
+		fprintf(stderr, "Error: RLE and anti-aliasing are for the row layout only\n");
+		return 1;
+	}
+	if (options.rle && options.bpp > 1)
+	{
+		fprintf(stderr, "Error: -z and -a do not go together\n");
+		return 1;
+	}
+	if (options.name.empty())
+	{
+		size_t slash = options.input.find_last_of('/');
+		std::string base = options.input.substr(slash == std::string::npos ? 0 : slash + 1);
+		base = base.substr(0, base.find('.'));
+		for (char c : base)
+			options.name += isalnum((unsigned char)c) ? c : '_';
+		if (options.name.empty() || isdigit((unsigned char)options.name[0]))
+			options.name = "Font_" + options.name;
+	}
+
+	// 1. Parse
+	Font_t font;
+	bool pcf = options.input.size() > 4 && options.input.compare(options.input.size() - 4, 4, ".pcf") == 0;
+	if (!(pcf ? pcfParse(options.input, font) : bdfParse(options.input, font)))
+	{
+		fprintf(stderr, "Error: cannot read %s as %s\n", options.input.c_str(), pcf ? "PCF" : "BDF");
+		return 1;
+	}
+
+	// 2. Keep the characters asked for, cropped, on lines tall enough for all of them
+	std::vector<Glyph_t> glyphs;
+	int lineTop = 0, lineBottom = font.ascent + font.descent;
+	if (options.bpp > 1)
+		lineBottom = (lineBottom + options.scale - 1) / options.scale;
+	for (auto &entry : font.glyphs)
+	{
+		if (entry.first > (options.columnLayout ? 0xFF : 0xFFFF))
+			continue;
+		if (entry.first > 0xFF ? !options.keep[entry.first] : (options.subset && !options.keep[entry.first]))
+			continue;
+		Glyph_t glyph = entry.second;
+		if (options.bpp > 1)
+			glyphShrink(glyph, options.scale, options.bpp);
+		glyphCrop(glyph);
+		if (glyph.height > 0)
+		{
+			lineTop = std::min(lineTop, glyph.top);
+			lineBottom = std::max(lineBottom, glyph.top + glyph.height);
+		}
+		glyphs.push_back(glyph);
+	}
+	if (glyphs.empty())
+	{
+		fprintf(stderr, "Error: no glyphs kept\n");
+		return 1;
+	}
+	for (Glyph_t &glyph : glyphs)
+		if (glyph.height > 0)
+			glyph.top -= lineTop;
+	int height = lineBottom - lineTop;
+	if (height > 127)
+	{
+		fprintf(stderr, "Error: line height %d, 127 max\n", height);
+		return 1;
+	}
+
+	// 3. Write
+	FILE *out = options.output.empty() ? stdout : fopen(options.output.c_str(), "w");
+	if (out == nullptr)
+	{
+		fprintf(stderr, "Error: cannot write %s\n", options.output.c_str());
+		return 1;
+	}
+	bool done = options.columnLayout ? columnLayoutWrite(out, options, glyphs, height)
+									 : rowLayoutWrite(out, options, glyphs, height);
+	if (out != stdout)
+		fclose(out);
+	return done ? 0 : 1;
+}
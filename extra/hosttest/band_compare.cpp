@@ -0,0 +1,181 @@
+/*!
+	@file     band_compare.cpp
+	@author   Gavin Lyons
+	@brief    Host check of band mode against direct rendering.
+	@details The same scene, a display list of every kind of draw call, is drawn directly
+		to the panel model and again in band mode with one and two band buffers, over
+		hardware SPI and over the PIO software SPI. After each step is flushed the panel
+		image must be the same as the direct one.
+	@note Run from ctest, or build/band_compare on its own. Exit status 0 = pass.
+*/
+
+#include "st7735/ST7735_TFT.hpp"
+#include <vector>
+
+#define PIN_RST 17
+#define PIN_DC 3
+#define PIN_CS 2
+#define PIN_SCLK 18
+#define PIN_SDA 19
+#define BAND_ROWS 16
+
+/*! How a run draws */
+struct Mode_t
+{
+	const char *name; /**< For the report */
+	uint8_t bands;	  /**< Band buffers, 0 = direct */
+	bool pio;		  /**< PIO software SPI, else hardware SPI */
+};
+
+/*! One scene step */
+struct Step_t
+{
+	const char *name;			  /**< For the report */
+	void (*draw)(ST7735_TFT &tft); /**< Draw calls */
+};
+
+static char textHello[] = "Hello World 123";
+static char textTime[] = "12:45";
+static char textArial[] = "Arial";
+
+static const Step_t scene[] = {
+	{"fillScreen", [](ST7735_TFT &tft) { tft.TFTfillScreen(ST7735_BLUE); }},
+	{"pixel", [](ST7735_TFT &tft) {
+		 tft.TFTdrawPixel(85, 5, ST7735_WHITE);
+		 tft.TFTdrawPixel(127, 159, ST7735_RED);
+	 }},
+	{"lines", [](ST7735_TFT &tft) {
+		 tft.TFTdrawLine(10, 10, 30, 30, ST7735_RED);
+		 tft.TFTdrawLine(0, 100, 127, 90, ST7735_GREEN);
+		 tft.TFTdrawLine(5, 0, 20, 150, ST7735_YELLOW);
+		 tft.TFTdrawLine(120, 5, 3, 40, ST7735_CYAN);
+		 tft.TFTdrawFastVLine(40, 40, 40, ST7735_GREEN);
+		 tft.TFTdrawFastHLine(60, 60, 40, ST7735_YELLOW);
+	 }},
+	{"rects", [](ST7735_TFT &tft) {
+		 tft.TFTdrawRectWH(5, 5, 20, 20, ST7735_RED);
+		 tft.TFTfillRectBuffer(45, 5, 20, 20, ST7735_YELLOW);
+		 tft.TFTfillRect(85, 5, 20, 20, ST7735_GREEN);
+		 tft.TFTdrawRoundRect(15, 60, 50, 50, 5, ST7735_CYAN);
+		 tft.TFTfillRoundRect(70, 60, 50, 50, 10, ST7735_WHITE);
+	 }},
+	{"circles", [](ST7735_TFT &tft) {
+		 tft.TFTdrawCircle(64, 64, 30, ST7735_RED);
+		 tft.TFTfillCircle(64, 100, 20, ST7735_GREEN);
+		 tft.TFTdrawCircle(10, 10, 15, ST7735_WHITE);
+	 }},
+	{"triangles", [](ST7735_TFT &tft) {
+		 tft.TFTdrawTriangle(5, 80, 50, 40, 95, 80, ST7735_CYAN);
+		 tft.TFTfillTriangle(55, 120, 100, 90, 127, 159, ST7735_RED);
+		 tft.TFTfillTriangle(0, 0, 0, 20, 30, 10, ST7735_RED);
+	 }},
+	{"text", [](ST7735_TFT &tft) {
+		 tft.TFTFontNum(tft.TFTFont_Default);
+		 tft.TFTdrawText(0, 0, textHello, ST7735_WHITE, ST7735_BLACK, 1);
+		 tft.TFTdrawText(0, 10, textHello, ST7735_WHITE, ST7735_BLACK, 2);
+		 tft.TFTdrawText(0, 50, textHello, ST7735_RED, ST7735_RED, 1);
+		 tft.TFTFontNum(tft.TFTFont_Bignum);
+		 tft.TFTdrawText(0, 60, textTime, ST7735_WHITE, ST7735_BLACK);
+		 tft.TFTFontNum(tft.TFTFont_ArialRound);
+		 tft.TFTdrawText(0, 100, textArial, ST7735_YELLOW, ST7735_BLUE);
+	 }},
+	{"print", [](ST7735_TFT &tft) {
+		 tft.TFTFontNum(tft.TFTFont_Default);
+		 tft.setTextColor(ST7735_GREEN, ST7735_BLACK);
+		 tft.TFTsetCursor(0, 140);
+		 tft.print("Print 3.14");
+		 tft.print(42);
+	 }},
+	{"bitmaps", [](ST7735_TFT &tft) {
+		 static uint8_t bitmap[16 * 16 / 8];
+		 static uint8_t bitmap16[20 * 10 * 2];
+		 for (unsigned i = 0; i < sizeof(bitmap); i++)
+			 bitmap[i] = (uint8_t)(i * 37);
+		 for (unsigned i = 0; i < sizeof(bitmap16); i++)
+			 bitmap16[i] = (uint8_t)(i * 13);
+		 tft.TFTdrawBitmap(100, 100, 16, 16, ST7735_WHITE, ST7735_RED, bitmap, sizeof(bitmap));
+		 tft.TFTdrawBitmap16Data(3, 3, bitmap16, 20, 10);
+		 tft.TFTdrawSpriteData(50, 140, bitmap16, 20, 10, 0x0D1A);
+	 }},
+	{"rotate90", [](ST7735_TFT &tft) {
+		 tft.TFTsetRotation(tft.TFT_Degrees_90); // band mode forgets the screen, redraw all of it
+		 tft.TFTfillScreen(ST7735_BLACK);
+		 tft.TFTfillRectBuffer(100, 10, 50, 20, ST7735_MAGENTA);
+		 tft.TFTdrawLine(0, 0, 159, 127, ST7735_WHITE);
+		 tft.TFTdrawText(90, 100, textTime, ST7735_WHITE, ST7735_BLACK, 2);
+	 }},
+	{"final", [](ST7735_TFT &tft) {
+		 tft.TFTsetRotation(tft.TFT_Degrees_0);
+		 tft.TFTfillRectBuffer(0, 0, 128, 160, ST7735_BLACK);
+		 tft.TFTfillRect(10, 10, 30, 30, ST7735_RED);
+	 }},
+};
+#define SCENE_STEPS (sizeof(scene) / sizeof(scene[0]))
+
+/*!
+	@brief Draw the scene, flushing after each step
+	@param mode how to draw
+	@return panel image hash after each step
+*/
+static std::vector<uint64_t> run(const Mode_t &mode)
+{
+	static uint16_t bandBuffer[2 * TFT_MAX_ROW_PIXELS * BAND_ROWS];
+	static uint8_t displayList[8192];
+	std::vector<uint64_t> hashes;
+
+	g_panel.reset();
+	g_panel.dcPin = PIN_DC;
+	g_panel.csPin = PIN_CS;
+	g_panel.sclkPin = PIN_SCLK;
+	g_panel.sdaPin = PIN_SDA;
+	ST7735_TFT tft;
+	if (mode.pio)
+		tft.TFTInitSPIType(0);
+	else
+		tft.TFTInitSPIType(8000, spi0);
+	tft.TFTSetupGPIO(PIN_RST, PIN_DC, PIN_CS, PIN_SCLK, PIN_SDA);
+	tft.TFTInitScreenSize(0, 0, 128, 160);
+	tft.TFTInitPCBType(tft.TFT_ST7735R_Red);
+	if (mode.bands > 0 && tft.TFTsetBandMode(bandBuffer, mode.bands, BAND_ROWS, displayList, sizeof(displayList)) != Display_Success)
+	{
+		printf("FAIL %s: TFTsetBandMode refused\n", mode.name);
+		return hashes;
+	}
+	for (const Step_t &step : scene)
+	{
+		g_panel.resetCounters();
+		step.draw(tft);
+		tft.TFTflush();
+		tft.TFTwaitIdle();
+		hashes.push_back(g_panel.hash());
+		printf("%-10s %-10s hash %016llx bytes %6ld commands %5ld transactions %5ld\n", mode.name, step.name,
+			   (unsigned long long)hashes.back(), g_panel.bytes, g_panel.cmds, g_panel.csFalls);
+	}
+	tft.TFTPowerDown();
+	return hashes;
+}
+
+int main(void)
+{
+	const Mode_t direct = {"direct", 0, false};
+	const Mode_t modes[] = {
+		{"band1", 1, false},
+		{"band2", 2, false},
+		{"band2 PIO", 2, true},
+	};
+	int failures = 0;
+
+	std::vector<uint64_t> expected = run(direct);
+	for (const Mode_t &mode : modes)
+	{
+		std::vector<uint64_t> got = run(mode);
+		for (size_t i = 0; i < SCENE_STEPS; i++)
+			if (i >= got.size() || got[i] != expected[i])
+			{
+				printf("FAIL %s: %s differs from direct rendering\n", mode.name, scene[i].name);
+				failures++;
+			}
+	}
+	printf("band_compare: %zu steps, 3 band modes, %d failures\n", SCENE_STEPS, failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+/*!
+	@file     glyph_bench.cpp
+	@author   Gavin Lyons
+	@brief    Host benchmark of RLE proportional glyphs against the same glyphs as bits.
+	@details TFTFontPropBigNum is RLE. A TFTGlyph_Bits copy with the same metrics is made
+		from it here, so the only difference is the encoding. Both draw the same text with
+		a background and without. The report gives flash bytes, SPI bytes, DMA transfers and
+		CS transactions per draw, and host CPU time per glyph with the SPI traffic counted
+		but not decoded, which is the decode and pixel fill cost on its own. Host times
+		only compare the two paths, they are not Pico cycles. Font 7, the fixed width
+		font the RLE one was made from, is shown for reference.
+	@note Run from ctest, or build/glyph_bench on its own. Exit status 0 = both encodings
+		draw the same image.
+*/
+
+#include "st7735/ST7735_TFT.hpp"
+#include <chrono>
+#include <vector>
+
+#define PIN_RST 17
+#define PIN_DC 3
+#define PIN_CS 2
+#define PIN_SCLK 18
+#define PIN_SDA 19
+#define BENCH_REPEATS 2000
+#define BENCH_TRIALS 5 // fastest is reported
+
+static char benchText[] = "12:45.-0";
+#define BENCH_GLYPHS (sizeof(benchText) - 1)
+
+/*! SPI traffic and time of one draw */
+struct Result_t
+{
+	long bytes;		   /**< Bytes on the wire */
+	long transfers;	   /**< DMA transfers */
+	long transactions; /**< CS low periods */
+	double nsPerGlyph; /**< Host CPU time per glyph */
+	uint64_t image;	   /**< Panel hash afterwards */
+};
+
+static std::vector<uint8_t> bitsBitmap;
+static std::vector<TFT_Glyph_t> bitsGlyphs;
+
+/*!
+	@brief Decode every glyph of an RLE font to one bit per pixel
+	@param rle the font
+	@return the same font stored as TFTGlyph_Bits
+*/
+static TFT_PropFont_t bitsFromRLE(const TFT_PropFont_t &rle)
+{
+	size_t glyphCount = (rle.last >= rle.first ? rle.last - rle.first + 1 : 0) + rle.codeCount;
+	for (size_t g = 0; g < glyphCount; g++)
+	{
+		TFT_Glyph_t glyph = rle.glyphs[g];
+		const uint8_t *data = rle.bitmap + glyph.bitmapOffset;
+		uint16_t boxPixels = glyph.width * glyph.height;
+		std::vector<uint8_t> pixels(boxPixels, 0);
+		for (uint16_t index = 0; index < boxPixels;)
+		{
+			uint8_t code = *data++;
+			index += code >> 4;
+			for (uint8_t set = code & 0x0F; set > 0 && index < boxPixels; set--)
+				pixels[index++] = 1;
+		}
+		glyph.bitmapOffset = (uint16_t)bitsBitmap.size();
+		bitsBitmap.resize(bitsBitmap.size() + (boxPixels + 7) / 8, 0);
+		for (uint16_t i = 0; i < boxPixels; i++)
+			if (pixels[i])
+				bitsBitmap[glyph.bitmapOffset + i / 8] |= 0x80 >> (i % 8);
+		bitsGlyphs.push_back(glyph);
+	}
+	TFT_PropFont_t bits = rle;
+	bits.bitmap = bitsBitmap.data();
+	bits.glyphs = bitsGlyphs.data();
+	bits.encoding = TFTGlyph_Bits;
+	return bits;
+}
+
+/*!
+	@brief Flash bytes of a proportional font's glyph data
+*/
+static size_t flashBytes(const TFT_PropFont_t &font)
+{
+	size_t glyphCount = (font.last >= font.first ? font.last - font.first + 1 : 0) + font.codeCount;
+	size_t end = 0;
+	for (size_t g = 0; g < glyphCount; g++)
+	{
+		const TFT_Glyph_t &glyph = font.glyphs[g];
+		if (font.encoding == TFTGlyph_Bits)
+		{
+			size_t glyphEnd = glyph.bitmapOffset + (glyph.width * glyph.height + 7) / 8;
+			end = (glyphEnd > end) ? glyphEnd : end;
+			continue;
+		}
+		const uint8_t *data = font.bitmap + glyph.bitmapOffset;
+		for (uint16_t index = 0; index < glyph.width * glyph.height; data++)
+			index += (*data >> 4) + (*data & 0x0F);
+		end = ((size_t)(data - font.bitmap) > end) ? (size_t)(data - font.bitmap) : end;
+	}
+	return end + glyphCount * sizeof(TFT_Glyph_t);
+}
+
+/*!
+	@brief Count the traffic of one draw, then time many with the SPI data not decoded
+*/
+template <typename Draw>
+static Result_t measure(ST7735_TFT &tft, Draw draw)
+{
+	Result_t result;
+	tft.TFTfillScreen(ST7735_BLACK);
+	tft.TFTwaitIdle();
+	g_panel.resetCounters();
+	draw();
+	tft.TFTwaitIdle();
+	result = {g_panel.bytes, g_panel.transfers, g_panel.csFalls, 0.0, g_panel.hash()};
+
+	g_panel.discard = true;
+	for (int trial = 0; trial < BENCH_TRIALS; trial++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < BENCH_REPEATS; i++)
+			draw();
+		tft.TFTwaitIdle();
+		auto stop = std::chrono::steady_clock::now();
+		double ns = std::chrono::duration<double, std::nano>(stop - start).count() / (BENCH_REPEATS * BENCH_GLYPHS);
+		if (trial == 0 || ns < result.nsPerGlyph)
+			result.nsPerGlyph = ns;
+	}
+	g_panel.discard = false;
+	return result;
+}
+
+static void report(const char *name, const char *mode, size_t flash, const Result_t &r)
+{
+	printf("%-12s %-11s %6zu | %6ld %9ld %12ld | %8.1f\n", name, mode, flash, r.bytes, r.transfers, r.transactions, r.nsPerGlyph);
+}
+
+int main(void)
+{
+	g_panel.dcPin = PIN_DC;
+	g_panel.csPin = PIN_CS;
+	ST7735_TFT tft;
+	tft.TFTInitSPIType(8000, spi0);
+	tft.TFTSetupGPIO(PIN_RST, PIN_DC, PIN_CS, PIN_SCLK, PIN_SDA);
+	tft.TFTInitScreenSize(0, 0, 128, 160);
+	tft.TFTInitPCBType(tft.TFT_ST7735R_Red);
+
+	const TFT_PropFont_t bitsFont = bitsFromRLE(TFTFontPropBigNum);
+	const struct
+	{
+		const char *name;
+		const TFT_PropFont_t *font;
+	} fonts[] = {{"bits", &bitsFont}, {"RLE", &TFTFontPropBigNum}};
+	const struct
+	{
+		const char *name;
+		uint16_t bg;
+	} modes[] = {{"background", ST7735_BLACK}, {"transparent", ST7735_WHITE}};
+
+	int failures = 0;
+	printf("\"%s\" at (0,40), per draw                  | host CPU\n", benchText);
+	printf("%-12s %-11s %6s | %6s %9s %12s | %8s\n", "font", "text", "flash", "bytes", "transfers", "transactions", "ns/glyph");
+	for (const auto &mode : modes)
+	{
+		Result_t results[2];
+		for (int f = 0; f < 2; f++)
+		{
+			tft.TFTsetFont(fonts[f].font);
+			results[f] = measure(tft, [&] { tft.TFTdrawText(0, 40, benchText, ST7735_WHITE, mode.bg); });
+			report(fonts[f].name, mode.name, flashBytes(*fonts[f].font), results[f]);
+		}
+		if (results[0].image != results[1].image)
+		{
+			printf("FAIL %s: RLE and bits glyphs draw different images\n", mode.name);
+			failures++;
+		}
+	}
+	tft.TFTFontNum(tft.TFTFont_Bignum);
+	const TFT_Font_t &font7 = TFTFontTable[tft.TFTFont_Bignum - 1];
+	report("font 7", "background", (size_t)font7.width * font7.height / 8 * font7.length, measure(tft, [&] { tft.TFTdrawText(0, 40, benchText, ST7735_WHITE, ST7735_BLACK); }));
+	tft.TFTPowerDown();
+	return failures == 0 ? 0 : 1;
+}
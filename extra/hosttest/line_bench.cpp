@@ -0,0 +1,136 @@
+/*!
+	@file     line_bench.cpp
+	@author   Gavin Lyons
+	@brief    Host benchmark of TFTdrawLine, SPI traffic per line before and after run slices.
+	@details "Before" is the original Bresenham loop with one TFTdrawPixel per pixel, kept
+		here as pixelLine. "After" is TFTdrawLine, one fill per horizontal or vertical run.
+		For each line the panel model counts commands, CS transactions and bytes. The two
+		must leave the same image on the panel. TFTdrawFastHLine / TFTdrawFastVLine of the
+		same length are shown as the lower bound.
+	@note Run from ctest, or build/line_bench on its own. Exit status 0 = images match.
+*/
+
+#include "st7735/ST7735_TFT.hpp"
+#include <cstdlib>
+#include <utility>
+
+#define PIN_RST 17
+#define PIN_DC 3
+#define PIN_CS 2
+#define PIN_SCLK 18
+#define PIN_SDA 19
+
+/*! SPI traffic of one draw */
+struct Traffic_t
+{
+	long commands;	   /**< Commands */
+	long transactions; /**< CS low periods */
+	long bytes;		   /**< Bytes on the wire */
+	uint64_t image;	   /**< Panel hash afterwards */
+};
+
+/*! A benchmark line */
+struct Line_t
+{
+	const char *name; /**< For the report */
+	int16_t x0, y0, x1, y1;
+};
+
+static const Line_t lines[] = {
+	{"horizontal", 0, 80, 127, 80},
+	{"vertical", 64, 0, 64, 159},
+	{"shallow", 0, 100, 127, 90},
+	{"steep", 5, 0, 20, 150},
+	{"diagonal", 0, 0, 127, 127},
+	{"anti-diagonal", 120, 5, 3, 40},
+	{"short", 10, 10, 30, 30},
+	{"off screen", -20, 150, 140, 170},
+};
+
+/*!
+	@brief TFTdrawLine as it was, one pixel write per pixel
+*/
+static void pixelLine(ST7735_TFT &tft, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	bool steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep)
+	{
+		std::swap(x0, y0);
+		std::swap(x1, y1);
+	}
+	if (x0 > x1)
+	{
+		std::swap(x0, x1);
+		std::swap(y0, y1);
+	}
+	int16_t dx = x1 - x0;
+	int16_t dy = abs(y1 - y0);
+	int16_t err = dx / 2;
+	int16_t ystep = (y0 < y1) ? 1 : -1;
+	for (; x0 <= x1; x0++)
+	{
+		if (steep)
+			tft.TFTdrawPixel(y0, x0, color);
+		else
+			tft.TFTdrawPixel(x0, y0, color);
+		err -= dy;
+		if (err < 0)
+		{
+			y0 += ystep;
+			err += dx;
+		}
+	}
+}
+
+/*!
+	@brief Clear the screen, then count the traffic of one draw
+*/
+template <typename Draw>
+static Traffic_t measure(ST7735_TFT &tft, Draw draw)
+{
+	tft.TFTfillScreen(ST7735_BLACK);
+	tft.TFTwaitIdle();
+	g_panel.resetCounters();
+	draw();
+	tft.TFTwaitIdle();
+	return {g_panel.cmds, g_panel.csFalls, g_panel.bytes, g_panel.hash()};
+}
+
+int main(void)
+{
+	g_panel.dcPin = PIN_DC;
+	g_panel.csPin = PIN_CS;
+	ST7735_TFT tft;
+	tft.TFTInitSPIType(8000, spi0);
+	tft.TFTSetupGPIO(PIN_RST, PIN_DC, PIN_CS, PIN_SCLK, PIN_SDA);
+	tft.TFTInitScreenSize(0, 0, 128, 160);
+	tft.TFTInitPCBType(tft.TFT_ST7735R_Red);
+
+	int failures = 0;
+	printf("%-14s %6s | %-21s | %-21s | %s\n", "", "", "per pixel (before)", "run slices (after)", "fast H/V line");
+	printf("%-14s %6s | %6s %6s %7s | %6s %6s %7s | %6s %6s\n", "line", "pixels", "cmds", "trans", "bytes",
+		   "cmds", "trans", "bytes", "cmds", "trans");
+	for (const Line_t &l : lines)
+	{
+		int16_t dx = (int16_t)abs(l.x1 - l.x0), dy = (int16_t)abs(l.y1 - l.y0);
+		int16_t length = (dx > dy ? dx : dy) + 1;
+		Traffic_t before = measure(tft, [&] { pixelLine(tft, l.x0, l.y0, l.x1, l.y1, ST7735_WHITE); });
+		Traffic_t after = measure(tft, [&] { tft.TFTdrawLine(l.x0, l.y0, l.x1, l.y1, ST7735_WHITE); });
+		Traffic_t fast = measure(tft, [&] {
+			if (dx > dy)
+				tft.TFTdrawFastHLine(0, 80, length, ST7735_WHITE);
+			else
+				tft.TFTdrawFastVLine(64, 0, length, ST7735_WHITE);
+		});
+		printf("%-14s %6d | %6ld %6ld %7ld | %6ld %6ld %7ld | %6ld %6ld\n", l.name, length,
+			   before.commands, before.transactions, before.bytes,
+			   after.commands, after.transactions, after.bytes, fast.commands, fast.transactions);
+		if (before.image != after.image)
+		{
+			printf("FAIL %s: TFTdrawLine draws different pixels to the per pixel line\n", l.name);
+			failures++;
+		}
+	}
+	tft.TFTPowerDown();
+	return failures == 0 ? 0 : 1;
+}
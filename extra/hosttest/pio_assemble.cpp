@@ -0,0 +1,180 @@
+/*!
+	@file     pio_assemble.cpp
+	@author   Gavin Lyons
+	@brief    Minimal pioasm for the host tests. Assembles ST7735_TFT_spi.pio into the
+			  same header the Pico SDK's pioasm makes, so the host build uses the program
+			  and the c-sdk block straight from the library source.
+	@details Knows the subset the library uses: .program, .side_set (not opt), .wrap_target,
+		.wrap, out, nop and a c-sdk block. Anything else is an error, use the real pioasm.
+	@note Usage: st7735_pioasm input.pio output.h
+*/
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+
+/*! Assembled program */
+struct Program_t
+{
+	std::string name;				   /**< .program name */
+	std::vector<uint16_t> instructions; /**< Instruction words */
+	unsigned sideCount = 0;			   /**< .side_set bits */
+	int wrapTarget = 0;				   /**< .wrap_target index */
+	int wrap = -1;					   /**< .wrap index, -1 = last instruction */
+	std::string cSdk;				   /**< c-sdk block */
+};
+
+static void fail(int line, const std::string &message)
+{
+	fprintf(stderr, "st7735_pioasm: line %d: %s\n", line, message.c_str());
+	exit(1);
+}
+
+static std::string trim(const std::string &s)
+{
+	size_t b = s.find_first_not_of(" \t\r");
+	size_t e = s.find_last_not_of(" \t\r");
+	return b == std::string::npos ? "" : s.substr(b, e - b + 1);
+}
+
+/*!
+	@brief Encode one instruction line
+	@param line source line, comment removed
+	@param program side-set width
+	@param lineNo for errors
+	@return instruction word
+	@details RP2040 datasheet 3.4: OUT is 011 ddd nnnnn, NOP is MOV Y, Y: 101 010 00 010.
+		The side-set value sits in the top bits of the 5 bit delay/side-set field.
+*/
+static uint16_t encode(std::string line, const Program_t &program, int lineNo)
+{
+	unsigned side = 0;
+	bool hasSide = false;
+	size_t sidePos = line.find(" side ");
+	if (sidePos != std::string::npos)
+	{
+		side = (unsigned)strtoul(line.c_str() + sidePos + 6, nullptr, 0);
+		hasSide = true;
+		line = trim(line.substr(0, sidePos));
+	}
+	if (program.sideCount > 0 && hasSide == false)
+		fail(lineNo, "side-set is not optional in this program");
+	if (line.find('[') != std::string::npos)
+		fail(lineNo, "delays are not supported");
+
+	std::istringstream in(line);
+	std::string op;
+	in >> op;
+	uint16_t word;
+	if (op == "nop")
+		word = 0xa042;
+	else if (op == "out")
+	{
+		std::string rest;
+		std::getline(in, rest);
+		size_t comma = rest.find(',');
+		if (comma == std::string::npos)
+			fail(lineNo, "out needs a destination and a bit count");
+		std::string dest = trim(rest.substr(0, comma));
+		unsigned count = (unsigned)strtoul(trim(rest.substr(comma + 1)).c_str(), nullptr, 0);
+		if (dest != "pins")
+			fail(lineNo, "only out pins is supported");
+		if (count < 1 || count > 32)
+			fail(lineNo, "bit count must be 1-32");
+		word = (uint16_t)(0x6000 | (count & 0x1f));
+	}
+	else
+		fail(lineNo, "unsupported instruction " + op);
+
+	if (program.sideCount > 0)
+	{
+		if (side >= (1u << program.sideCount))
+			fail(lineNo, "side-set value too big");
+		word |= (uint16_t)(side << (13 - program.sideCount));
+	}
+	return word;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: st7735_pioasm input.pio output.h\n");
+		return 1;
+	}
+	std::ifstream in(argv[1]);
+	if (!in)
+	{
+		fprintf(stderr, "st7735_pioasm: cannot open %s\n", argv[1]);
+		return 1;
+	}
+
+	Program_t program;
+	std::string raw;
+	int lineNo = 0;
+	bool inSdk = false;
+	while (std::getline(in, raw))
+	{
+		lineNo++;
+		if (inSdk)
+		{
+			if (trim(raw) == "%}")
+				inSdk = false;
+			else
+				program.cSdk += raw + "\n";
+			continue;
+		}
+		std::string line = trim(raw.substr(0, raw.find(';')));
+		if (line.empty())
+			continue;
+		if (line.rfind("% c-sdk {", 0) == 0)
+			inSdk = true;
+		else if (line.rfind(".program ", 0) == 0)
+			program.name = trim(line.substr(9));
+		else if (line.rfind(".side_set ", 0) == 0)
+		{
+			if (line.find(" opt") != std::string::npos)
+				fail(lineNo, ".side_set opt is not supported");
+			program.sideCount = (unsigned)strtoul(line.c_str() + 10, nullptr, 0);
+		}
+		else if (line == ".wrap_target")
+			program.wrapTarget = (int)program.instructions.size();
+		else if (line == ".wrap")
+			program.wrap = (int)program.instructions.size() - 1;
+		else if (line[0] == '.' || line[0] == '%')
+			fail(lineNo, "unsupported directive " + line);
+		else
+			program.instructions.push_back(encode(line, program, lineNo));
+	}
+	if (program.name.empty() || program.instructions.empty())
+		fail(lineNo, "no program found");
+	if (program.wrap < 0)
+		program.wrap = (int)program.instructions.size() - 1;
+
+	FILE *out = fopen(argv[2], "w");
+	if (out == nullptr)
+	{
+		fprintf(stderr, "st7735_pioasm: cannot write %s\n", argv[2]);
+		return 1;
+	}
+	const char *name = program.name.c_str();
+	fprintf(out, "// Generated by st7735_pioasm from %s, do not edit\n\n#pragma once\n\n#include \"hardware/pio.h\"\n\n", argv[1]);
+	fprintf(out, "#define %s_wrap_target %d\n#define %s_wrap %d\n\n", name, program.wrapTarget, name, program.wrap);
+	fprintf(out, "static const uint16_t %s_program_instructions[] = {\n", name);
+	for (uint16_t word : program.instructions)
+		fprintf(out, "\t0x%04x,\n", word);
+	fprintf(out, "};\n\nstatic const struct pio_program %s_program = {\n\t%s_program_instructions,\n\t%zu,\n\t-1,\n};\n\n",
+			name, name, program.instructions.size());
+	fprintf(out, "static inline pio_sm_config %s_program_get_default_config(uint offset)\n{\n", name);
+	fprintf(out, "\tpio_sm_config c = pio_get_default_sm_config();\n");
+	fprintf(out, "\tsm_config_set_wrap(&c, offset + %s_wrap_target, offset + %s_wrap);\n", name, name);
+	if (program.sideCount > 0)
+		fprintf(out, "\tsm_config_set_sideset(&c, %u, false, false);\n", program.sideCount);
+	fprintf(out, "\treturn c;\n}\n\n%s", program.cSdk.c_str());
+	fclose(out);
+	return 0;
+}
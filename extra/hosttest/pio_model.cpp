@@ -0,0 +1,142 @@
+/*!
+	@file     pio_model.cpp
+	@author   Gavin Lyons
+	@brief    Host check of the PIO software SPI against the GPIO bit bang version.
+	@details The driver is run twice on the host SDK model: once on a PIO state machine
+		stepping ST7735_TFT_spi.pio instruction by instruction (out pins, 1 side 0 /
+		nop side 1, left shift, autopull at 8 bits), once with spiWriteSoftware. For every
+		byte value the MOSI/SCLK waveform of each is checked for SPI mode 0 and the bits
+		sampled on the rising edges must be the same, MSB first.
+	@note Run from ctest, or build/pio_model on its own. Exit status 0 = pass.
+*/
+
+#include "st7735/ST7735_TFT.hpp"
+#include <vector>
+
+#define PIN_RST 17
+#define PIN_DC 3
+#define PIN_CS 2
+#define PIN_SCLK 18
+#define PIN_SDA 19
+
+/*! Driver with the byte writer exposed */
+class SPIProbe : public ST7735_TFT
+{
+public:
+	using ST7735_TFT_graphics::spiWrite;
+};
+
+/*! MOSI/SCLK activity while one byte is sent */
+struct Waveform_t
+{
+	std::vector<uint8_t> samples; /**< MOSI at each SCLK rising edge */
+	int fallingEdges = 0;		  /**< SCLK falling edges */
+	bool mosiMovedHigh = false;	  /**< MOSI changed while SCLK was high */
+	bool sclk = false;			  /**< SCLK level */
+	bool mosi = false;			  /**< MOSI level */
+};
+
+static Waveform_t wave;
+
+static void pinWatch(int8_t pin, bool level)
+{
+	if (pin == PIN_SCLK && level != wave.sclk)
+	{
+		if (level)
+			wave.samples.push_back(wave.mosi);
+		else
+			wave.fallingEdges++;
+		wave.sclk = level;
+	}
+	else if (pin == PIN_SDA && level != wave.mosi)
+	{
+		if (wave.sclk)
+			wave.mosiMovedHigh = true;
+		wave.mosi = level;
+	}
+}
+
+static void tftStart(SPIProbe &tft, bool usePIO)
+{
+	g_panel.dcPin = PIN_DC;
+	g_panel.csPin = PIN_CS;
+	g_panel.sclkPin = PIN_SCLK;
+	g_panel.sdaPin = PIN_SDA;
+	tft.TFTInitSPIType(0, usePIO);
+	tft.TFTSetupGPIO(PIN_RST, PIN_DC, PIN_CS, PIN_SCLK, PIN_SDA);
+	tft.TFTInitScreenSize(0, 0, 128, 160);
+	tft.TFTInitPCBType(tft.TFT_ST7735R_Red);
+}
+
+/*!
+	@brief Send one byte and return what happened on the wire
+	@param tft driver
+	@param value byte
+	@return waveform, SCLK and MOSI levels carried over from the previous byte
+*/
+static Waveform_t capture(SPIProbe &tft, uint8_t value)
+{
+	wave.samples.clear();
+	wave.fallingEdges = 0;
+	wave.mosiMovedHigh = false;
+	wave.sclk = g_panel.pins[PIN_SCLK];
+	wave.mosi = g_panel.pins[PIN_SDA];
+	g_panel.pinHook = pinWatch;
+	tft.spiWrite(value);
+	g_panel.pinHook = nullptr;
+	return wave;
+}
+
+static bool check(const char *name, const Waveform_t &w, uint8_t value)
+{
+	bool ok = w.samples.size() == 8 && w.fallingEdges == 8 && !w.mosiMovedHigh && !w.sclk;
+	for (size_t i = 0; ok && i < 8; i++)
+		ok = w.samples[i] == ((value >> (7 - i)) & 1);
+	if (!ok)
+		printf("FAIL %s 0x%02x: %zu rising %d falling edges, MOSI moved with SCLK high %d, SCLK ends %s\n",
+			   name, value, w.samples.size(), w.fallingEdges, w.mosiMovedHigh, w.sclk ? "high" : "low");
+	return ok;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	SPIProbe pioTFT;
+	tftStart(pioTFT, true);
+	if (g_pio0.claimed[0] == false || g_pio0.used != 2)
+	{
+		printf("FAIL the driver did not load the SPI program on a PIO state machine\n");
+		return 1;
+	}
+	// Encodings from the RP2040 datasheet, .side_set 1 puts the clock in bit 12
+	if (g_pio0.instructionMemory[0] != 0x6001 || g_pio0.instructionMemory[1] != 0xb042)
+	{
+		printf("FAIL program is %04x %04x, expected 6001 (out pins, 1 side 0) b042 (nop side 1)\n",
+			   g_pio0.instructionMemory[0], g_pio0.instructionMemory[1]);
+		failures++;
+	}
+	std::vector<Waveform_t> pioWaves;
+	for (int value = 0; value < 256; value++)
+		pioWaves.push_back(capture(pioTFT, (uint8_t)value));
+	pioTFT.TFTPowerDown();
+
+	SPIProbe gpioTFT;
+	tftStart(gpioTFT, false);
+	for (int value = 0; value < 256; value++)
+	{
+		Waveform_t gpioWave = capture(gpioTFT, (uint8_t)value);
+		bool pioOk = check("PIO", pioWaves[value], (uint8_t)value);
+		bool gpioOk = check("GPIO", gpioWave, (uint8_t)value);
+		if (pioOk && gpioOk && pioWaves[value].samples != gpioWave.samples)
+		{
+			printf("FAIL 0x%02x: PIO and GPIO sample different bits\n", value);
+			pioOk = false;
+		}
+		failures += !(pioOk && gpioOk);
+	}
+	gpioTFT.TFTPowerDown();
+
+	printf("pio_model: 256 byte values, %d failures\n", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,15 @@
+/*!
+	@file     hardware/clocks.h
+	@brief    Host stand in for the Pico SDK header, fixed 125MHz system clock.
+*/
+
+#pragma once
+
+#include "../pico/stdlib.h"
+
+enum clock_index
+{
+	clk_sys = 5
+};
+
+inline uint32_t clock_get_hz(clock_index) { return 125000000; }
@@ -0,0 +1,75 @@
+/*!
+	@file     hardware/dma.h
+	@brief    Host stand in for the Pico SDK header. A triggered transfer runs to the end
+			  inside the call, into the SPI model or a PIO TX FIFO.
+*/
+
+#pragma once
+
+#include "spi.h"
+
+#define NUM_DMA_CHANNELS 12
+
+enum dma_channel_transfer_size
+{
+	DMA_SIZE_8 = 0,
+	DMA_SIZE_16 = 1,
+	DMA_SIZE_32 = 2
+};
+
+/*! Channel configuration, the fields the driver sets */
+typedef struct
+{
+	dma_channel_transfer_size size; /**< Transfer size */
+	bool readIncrement;				/**< Step the read address */
+	bool writeIncrement;			/**< Step the write address */
+	uint dreq;						/**< Pacing request */
+} dma_channel_config;
+
+/*! Channel registers */
+struct HostDMAChannel
+{
+	dma_channel_config config;	/**< Configuration */
+	volatile void *write;		/**< Write address */
+	const volatile void *read;	/**< Read address */
+	uint count;					/**< Transfer count */
+};
+
+extern HostDMAChannel g_dmaChannels[NUM_DMA_CHANNELS];
+void hostDMARun(uint channel);
+
+inline int dma_claim_unused_channel(bool) { return 3; }
+inline void dma_channel_unclaim(uint) {}
+inline dma_channel_config dma_channel_get_default_config(uint)
+{
+	dma_channel_config c = {DMA_SIZE_32, true, false, 0x3f};
+	return c;
+}
+inline dma_channel_config dma_get_channel_config(uint channel) { return g_dmaChannels[channel].config; }
+inline void channel_config_set_transfer_data_size(dma_channel_config *c, dma_channel_transfer_size size) { c->size = size; }
+inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) { c->readIncrement = incr; }
+inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) { c->writeIncrement = incr; }
+inline void channel_config_set_dreq(dma_channel_config *c, uint dreq) { c->dreq = dreq; }
+
+inline void dma_channel_configure(uint channel, const dma_channel_config *c, volatile void *write, const volatile void *read, uint count, bool trigger)
+{
+	g_dmaChannels[channel] = {*c, write, read, count};
+	if (trigger)
+		hostDMARun(channel);
+}
+inline void dma_channel_set_config(uint channel, const dma_channel_config *c, bool trigger)
+{
+	g_dmaChannels[channel].config = *c;
+	if (trigger)
+		hostDMARun(channel);
+}
+inline void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read, uint count)
+{
+	g_dmaChannels[channel].read = read;
+	g_dmaChannels[channel].count = count;
+	hostDMARun(channel);
+}
+inline void dma_channel_wait_for_finish_blocking(uint) {}
+inline void dma_channel_set_irq0_enabled(uint, bool) {}
+inline bool dma_channel_get_irq0_status(uint) { return false; }
+inline void dma_channel_acknowledge_irq0(uint) {}
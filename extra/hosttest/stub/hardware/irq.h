@@ -0,0 +1,17 @@
+/*!
+	@file     hardware/irq.h
+	@brief    Host stand in for the Pico SDK header, DMA finishes inside the call so no interrupts.
+*/
+
+#pragma once
+
+#include "../pico/stdlib.h"
+
+#define DMA_IRQ_0 11
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+typedef void (*irq_handler_t)(void);
+
+inline void irq_add_shared_handler(uint, irq_handler_t, uint8_t) {}
+inline void irq_remove_handler(uint, irq_handler_t) {}
+inline void irq_set_enabled(uint, bool) {}
@@ -0,0 +1,166 @@
+/*!
+	@file     hardware/pio.h
+	@brief    Host stand in for the Pico SDK header. The state machines execute the
+			  loaded program bit by bit, see hostPIORun, driving the panel model's GPIO.
+	@note Only the OUT and MOV instructions with one mandatory side-set pin are executed,
+		which is all ST7735_TFT_spi.pio uses.
+*/
+
+#pragma once
+
+#include "../pico/stdlib.h"
+#include <deque>
+
+#define PIO_INSTRUCTION_COUNT 32
+#define PIO_FDEBUG_TXSTALL_LSB 24
+#define PIO_SM0_SHIFTCTRL_PULL_THRESH_LSB 25
+#define PIO_SM0_SHIFTCTRL_PULL_THRESH_BITS 0x3e000000u
+#define PIO_SM0_SHIFTCTRL_OUT_SHIFTDIR_BITS 0x00080000u
+#define PIO_SM0_SHIFTCTRL_AUTOPULL_BITS 0x00020000u
+
+/*! Program as emitted by pioasm */
+struct pio_program
+{
+	const uint16_t *instructions; /**< Instruction words */
+	uint8_t length;				  /**< Instruction count */
+	int8_t origin;				  /**< Fixed load address, -1 = any */
+};
+
+/*! State machine configuration, register layout simplified */
+typedef struct
+{
+	uint32_t clkdiv;	/**< Integer clock divider */
+	uint32_t shiftctrl; /**< SHIFTCTRL register value */
+	uint wrapBottom;	/**< Wrap target, absolute */
+	uint wrapTop;		/**< Wrap source, absolute */
+	uint outBase;		/**< First OUT pin */
+	uint sideBase;		/**< Side-set pin */
+	uint sideCount;		/**< Side-set bits */
+} pio_sm_config;
+
+/*! One state machine */
+struct HostPIOStateMachine
+{
+	volatile uint32_t shiftctrl = 0; /**< SHIFTCTRL, the driver changes the pull threshold here */
+	pio_sm_config config = {};		 /**< Configuration from pio_sm_init */
+	bool enabled = false;			 /**< Running */
+	uint pc = 0;					 /**< Program counter */
+	uint32_t osr = 0;				 /**< Output shift register */
+	uint osrCount = 32;				 /**< Bits shifted out of the OSR, 32 = empty */
+	std::deque<uint32_t> fifo;		 /**< TX FIFO */
+	long cycles = 0;				 /**< Instructions executed */
+};
+
+/*! PIO block */
+typedef struct pio_hw
+{
+	volatile uint32_t fdebug;				   /**< FDEBUG, write 1 to clear */
+	volatile uint32_t txf[4];				   /**< TX FIFO addresses, DMA target */
+	uint16_t instructionMemory[PIO_INSTRUCTION_COUNT]; /**< Loaded programs */
+	uint used;								   /**< Instruction slots used */
+	bool claimed[4];						   /**< State machines claimed */
+	HostPIOStateMachine sm[4];				   /**< State machines */
+} pio_hw_t;
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t g_pio0, g_pio1;
+#define pio0 (&g_pio0)
+#define pio1 (&g_pio1)
+
+enum pio_fifo_join
+{
+	PIO_FIFO_JOIN_NONE = 0,
+	PIO_FIFO_JOIN_TX = 1
+};
+
+void hostPIORun(PIO pio, uint sm);
+void hostPIOPut(volatile void *txf, uint32_t value, int size);
+
+inline bool pio_can_add_program(PIO pio, const pio_program *program) { return pio->used + program->length <= PIO_INSTRUCTION_COUNT; }
+inline uint pio_add_program(PIO pio, const pio_program *program)
+{
+	uint offset = pio->used;
+	for (uint i = 0; i < program->length; i++)
+	{
+		uint16_t instruction = program->instructions[i];
+		if ((instruction & 0xE000) == 0x0000) // JMP, relocate the target
+			instruction = (uint16_t)(instruction + offset);
+		pio->instructionMemory[offset + i] = instruction;
+	}
+	pio->used += program->length;
+	return offset;
+}
+inline void pio_remove_program(PIO pio, const pio_program *program, uint offset)
+{
+	if (offset + program->length == pio->used)
+		pio->used = offset;
+}
+inline int pio_claim_unused_sm(PIO pio, bool)
+{
+	for (int i = 0; i < 4; i++)
+		if (!pio->claimed[i])
+		{
+			pio->claimed[i] = true;
+			return i;
+		}
+	return -1;
+}
+inline void pio_sm_unclaim(PIO pio, uint sm) { pio->claimed[sm] = false; }
+inline void pio_gpio_init(PIO, uint) {}
+inline int pio_sm_set_consecutive_pindirs(PIO, uint, uint, uint, bool) { return 0; }
+inline void pio_sm_set_pins_with_mask(PIO, uint, uint32_t values, uint32_t mask)
+{
+	for (int i = 0; i < PANEL_MODEL_PINS; i++)
+		if (mask & (1u << i))
+			g_panel.setPin((int8_t)i, (values >> i) & 1);
+}
+inline uint pio_get_dreq(PIO pio, uint sm, bool) { return (pio == pio0 ? 0 : 8) + sm; }
+
+inline pio_sm_config pio_get_default_sm_config(void)
+{
+	pio_sm_config c = {};
+	c.clkdiv = 1;
+	c.shiftctrl = PIO_SM0_SHIFTCTRL_OUT_SHIFTDIR_BITS; // reset value, shift right, no autopull, threshold 32
+	c.wrapTop = PIO_INSTRUCTION_COUNT - 1;
+	return c;
+}
+inline void sm_config_set_wrap(pio_sm_config *c, uint wrapTarget, uint wrap)
+{
+	c->wrapBottom = wrapTarget;
+	c->wrapTop = wrap;
+}
+inline void sm_config_set_sideset(pio_sm_config *c, uint bitCount, bool, bool) { c->sideCount = bitCount; }
+inline void sm_config_set_sideset_pins(pio_sm_config *c, uint base) { c->sideBase = base; }
+inline void sm_config_set_out_pins(pio_sm_config *c, uint base, uint) { c->outBase = base; }
+inline void sm_config_set_fifo_join(pio_sm_config *, pio_fifo_join) {}
+inline void sm_config_set_clkdiv_int_frac(pio_sm_config *c, uint16_t divInt, uint8_t) { c->clkdiv = divInt; }
+inline void sm_config_set_out_shift(pio_sm_config *c, bool shiftRight, bool autopull, uint pullThreshold)
+{
+	c->shiftctrl = (shiftRight ? PIO_SM0_SHIFTCTRL_OUT_SHIFTDIR_BITS : 0) |
+				   (autopull ? PIO_SM0_SHIFTCTRL_AUTOPULL_BITS : 0) |
+				   ((pullThreshold & 0x1fu) << PIO_SM0_SHIFTCTRL_PULL_THRESH_LSB);
+}
+inline int pio_sm_init(PIO pio, uint sm, uint initialPc, const pio_sm_config *c)
+{
+	HostPIOStateMachine &m = pio->sm[sm];
+	m.config = *c;
+	m.shiftctrl = c->shiftctrl;
+	m.pc = initialPc;
+	m.osrCount = 32;
+	m.fifo.clear();
+	return 0;
+}
+inline void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+	pio->sm[sm].enabled = enabled;
+	if (enabled)
+		hostPIORun(pio, sm);
+}
+inline void pio_sm_set_clkdiv_int_frac(PIO pio, uint sm, uint16_t divInt, uint8_t) { pio->sm[sm].config.clkdiv = divInt; }
+inline void pio_sm_restart(PIO pio, uint sm) { pio->sm[sm].osrCount = 32; }
+inline void hw_write_masked(volatile uint32_t *addr, uint32_t values, uint32_t mask) { *addr = (*addr & ~mask) | (values & mask); }
+inline void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data)
+{
+	pio->sm[sm].fifo.push_back(data);
+	hostPIORun(pio, sm);
+}
@@ -0,0 +1,52 @@
+/*!
+	@file     hardware/spi.h
+	@brief    Host stand in for the Pico SDK header, frames go straight to the panel model.
+*/
+
+#pragma once
+
+#include "../pico/stdlib.h"
+
+/*! SPI block, only the registers the driver touches */
+typedef struct
+{
+	volatile uint32_t dr;  /**< Data register, DMA target */
+	volatile uint32_t sr;  /**< Status */
+	volatile uint32_t icr; /**< Interrupt clear */
+	uint bits;			   /**< Frame size set by spi_set_format */
+} spi_hw_t;
+typedef spi_hw_t spi_inst_t;
+
+extern spi_hw_t g_spi0, g_spi1;
+#define spi0 (&g_spi0)
+#define spi1 (&g_spi1)
+
+typedef enum { SPI_CPOL_0 = 0, SPI_CPOL_1 = 1 } spi_cpol_t;
+typedef enum { SPI_CPHA_0 = 0, SPI_CPHA_1 = 1 } spi_cpha_t;
+typedef enum { SPI_LSB_FIRST = 0, SPI_MSB_FIRST = 1 } spi_order_t;
+
+#define SPI_SSPICR_RORIC_BITS 1
+
+inline uint spi_init(spi_inst_t *spi, uint baudrate)
+{
+	spi->bits = 8;
+	return baudrate;
+}
+inline void spi_deinit(spi_inst_t *) {}
+inline void spi_set_format(spi_inst_t *spi, uint bits, spi_cpol_t, spi_cpha_t, spi_order_t) { spi->bits = bits; }
+inline spi_hw_t *spi_get_hw(spi_inst_t *spi) { return spi; }
+inline uint spi_get_dreq(spi_inst_t *spi, bool) { return spi == spi0 ? 16 : 18; }
+inline bool spi_is_busy(const spi_inst_t *) { return false; }
+inline bool spi_is_readable(const spi_inst_t *) { return false; }
+inline int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len)
+{
+	for (size_t i = 0; i < len; i++)
+		g_panel.frame(src[i], (int)spi->bits);
+	return (int)len;
+}
+inline int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len)
+{
+	for (size_t i = 0; i < len; i++)
+		g_panel.frame(src[i], (int)spi->bits);
+	return (int)len;
+}
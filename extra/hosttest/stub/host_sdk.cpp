@@ -0,0 +1,137 @@
+/*!
+	@file     host_sdk.cpp
+	@author   Gavin Lyons
+	@brief    Host stand in for the Pico SDK hardware the driver uses: the panel model,
+			  DMA channels and a bit level PIO state machine.
+*/
+
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+
+PanelModel g_panel;
+spi_hw_t g_spi0, g_spi1;
+pio_hw_t g_pio0, g_pio1;
+HostDMAChannel g_dmaChannels[NUM_DMA_CHANNELS];
+
+/*!
+	@brief Run a DMA transfer to the end, into an SPI data register or a PIO TX FIFO
+	@param channel DMA channel
+*/
+void hostDMARun(uint channel)
+{
+	HostDMAChannel &ch = g_dmaChannels[channel];
+	spi_hw_t *spi = (ch.write == &g_spi0.dr) ? &g_spi0 : (ch.write == &g_spi1.dr ? &g_spi1 : nullptr);
+	const uint8_t *read = (const uint8_t *)ch.read;
+	int size = 1 << ch.config.size;
+	g_panel.transfers++;
+	if (spi != nullptr && g_panel.discard)
+	{
+		g_panel.bytes += (long)ch.count * (spi->bits == 16 ? 2 : 1);
+		return;
+	}
+	for (uint i = 0; i < ch.count; i++)
+	{
+		uint32_t value;
+		if (size == 1)
+			value = *read;
+		else if (size == 2)
+			value = *(const uint16_t *)read;
+		else
+			value = *(const uint32_t *)read;
+		if (ch.config.readIncrement)
+			read += size;
+		if (spi != nullptr)
+			g_panel.frame(value, (int)spi->bits);
+		else
+			hostPIOPut(ch.write, value, size);
+	}
+}
+
+/*!
+	@brief A DMA write to a PIO TX FIFO
+	@param txf FIFO address
+	@param value data
+	@param size bytes per transfer, narrow writes are replicated across the bus as on the RP2040
+*/
+void hostPIOPut(volatile void *txf, uint32_t value, int size)
+{
+	for (PIO pio : {pio0, pio1})
+		for (uint sm = 0; sm < 4; sm++)
+			if (txf == &pio->txf[sm])
+			{
+				if (size == 1)
+					value *= 0x01010101u;
+				else if (size == 2)
+					value *= 0x00010001u;
+				pio_sm_put_blocking(pio, sm, value);
+				return;
+			}
+}
+
+/*!
+	@brief Step a state machine until it stalls on an OUT with the OSR and TX FIFO empty
+	@param pio PIO block
+	@param sm state machine
+	@details Instruction format from the RP2040 datasheet: opcode in bits 15:13, side-set
+		in the top bits of the delay field 12:8. OUT: destination 7:5, bit count 4:0.
+		MOV: destination 7:5, operation 4:3, source 2:0, only used here as a NOP (mov y, y).
+		Side-set takes effect as the instruction starts, even when it stalls.
+*/
+void hostPIORun(PIO pio, uint sm)
+{
+	HostPIOStateMachine &m = pio->sm[sm];
+	if (m.enabled == false)
+		return;
+	for (;;)
+	{
+		uint16_t instruction = pio->instructionMemory[m.pc];
+		uint opcode = instruction >> 13;
+		if (m.config.sideCount > 0)
+		{
+			uint side = (instruction >> (13 - m.config.sideCount)) & ((1u << m.config.sideCount) - 1);
+			for (uint i = 0; i < m.config.sideCount; i++)
+				g_panel.setPin((int8_t)(m.config.sideBase + i), (side >> i) & 1);
+		}
+		if (opcode == 3) // OUT
+		{
+			uint bitCount = instruction & 0x1f;
+			if (bitCount == 0)
+				bitCount = 32;
+			uint threshold = (m.shiftctrl & PIO_SM0_SHIFTCTRL_PULL_THRESH_BITS) >> PIO_SM0_SHIFTCTRL_PULL_THRESH_LSB;
+			if (threshold == 0)
+				threshold = 32;
+			if ((m.shiftctrl & PIO_SM0_SHIFTCTRL_AUTOPULL_BITS) && m.osrCount >= threshold)
+			{
+				if (m.fifo.empty())
+				{
+					pio->fdebug |= 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+					return;
+				}
+				m.osr = m.fifo.front();
+				m.fifo.pop_front();
+				m.osrCount = 0;
+			}
+			uint32_t value;
+			if (m.shiftctrl & PIO_SM0_SHIFTCTRL_OUT_SHIFTDIR_BITS)
+			{
+				value = (uint32_t)(m.osr & ((1ull << bitCount) - 1));
+				m.osr = (uint32_t)((uint64_t)m.osr >> bitCount);
+			}
+			else
+			{
+				value = (uint32_t)((uint64_t)m.osr >> (32 - bitCount));
+				m.osr = (uint32_t)((uint64_t)m.osr << bitCount);
+			}
+			m.osrCount += bitCount;
+			if (((instruction >> 5) & 7) == 0) // PINS
+				g_panel.setPin((int8_t)m.config.outBase, value & 1);
+		}
+		else if (opcode != 5) // MOV
+		{
+			fprintf(stderr, "hostPIORun: unsupported instruction %04x\n", instruction);
+			return;
+		}
+		m.cycles++;
+		m.pc = (m.pc == m.config.wrapTop) ? m.config.wrapBottom : m.pc + 1;
+	}
+}
@@ -0,0 +1,182 @@
+/*!
+	@file     panel_model.hpp
+	@author   Gavin Lyons
+	@brief    Host model of the ST7735 panel for the host tests. Decodes the byte stream
+			  the driver sends, from hardware SPI frames, DMA, PIO or GPIO bit bang, into
+			  a GRAM image and counts bytes, commands and CS transactions.
+	@note Only the commands the driver needs for drawing are modelled: CASET, RASET,
+		RAMWR and MADCTL row/column exchange.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+#define PANEL_MODEL_ROWS 162 /**< GRAM rows, the largest ST7735 panel */
+#define PANEL_MODEL_COLS 132 /**< GRAM columns */
+#define PANEL_MODEL_PINS 32	 /**< GPIO modelled */
+
+/*! Panel and GPIO state seen by the host tests */
+struct PanelModel
+{
+	int8_t dcPin = -1;	 /**< Data or command GPIO, low = command */
+	int8_t csPin = -1;	 /**< Chip select GPIO */
+	int8_t sclkPin = -1; /**< Software SPI clock GPIO */
+	int8_t sdaPin = -1;	 /**< Software SPI data GPIO */
+	bool pins[PANEL_MODEL_PINS] = {};				 /**< GPIO output levels */
+	void (*pinHook)(int8_t pin, bool level) = nullptr; /**< Optional, called on every GPIO write */
+
+	uint16_t gram[PANEL_MODEL_ROWS][PANEL_MODEL_COLS] = {}; /**< Panel memory, RGB565 */
+	long bytes = 0;		  /**< Bytes received */
+	long cmds = 0;		  /**< Commands received */
+	long csFalls = 0;	  /**< CS falling edges, one per transaction */
+	long transfers = 0;	  /**< DMA transfers */
+	bool discard = false; /**< Count DMA bytes without decoding them, for timing the driver alone */
+
+	/*! @brief Forget everything but the pin assignment */
+	void reset(void)
+	{
+		PanelModel fresh;
+		fresh.dcPin = dcPin;
+		fresh.csPin = csPin;
+		fresh.sclkPin = sclkPin;
+		fresh.sdaPin = sdaPin;
+		fresh.pinHook = pinHook;
+		*this = fresh;
+	}
+
+	/*! @brief Zero the traffic counters */
+	void resetCounters(void) { bytes = cmds = csFalls = transfers = 0; }
+
+	/*!
+		@brief A GPIO write, samples SDA on the rising edge of SCLK as the panel does
+		@param pin GPIO
+		@param level new level
+	*/
+	void setPin(int8_t pin, bool level)
+	{
+		if (pin < 0 || pin >= PANEL_MODEL_PINS)
+			return;
+		if (pinHook != nullptr)
+			pinHook(pin, level);
+		if (pin == csPin && pins[pin] && !level)
+			csFalls++;
+		if (pin == sclkPin && !pins[pin] && level && sdaPin >= 0)
+		{
+			_shift = (uint8_t)((_shift << 1) | (pins[sdaPin] ? 1 : 0));
+			if (++_shiftBits == 8)
+			{
+				_shiftBits = 0;
+				byte(_shift);
+			}
+		}
+		pins[pin] = level;
+	}
+
+	/*!
+		@brief One SPI frame from the hardware SPI model
+		@param value frame
+		@param bits frame size, 8 or 16
+	*/
+	void frame(uint32_t value, int bits)
+	{
+		if (bits == 16)
+			byte((uint8_t)(value >> 8));
+		byte((uint8_t)value);
+	}
+
+	/*!
+		@brief One byte on the wire, DC decides command or parameter
+		@param b byte
+	*/
+	void byte(uint8_t b)
+	{
+		bytes++;
+		if (dcPin >= 0 && !pins[dcPin])
+		{
+			_cmd = b;
+			_argIndex = 0;
+			_pixelHalf = false;
+			cmds++;
+			if (b == 0x2C)
+			{
+				_cx = _xs;
+				_cy = _ys;
+			}
+			return;
+		}
+		if (_cmd == 0x2C)
+		{
+			if (!_pixelHalf)
+			{
+				_pixelHigh = b;
+				_pixelHalf = true;
+			}
+			else
+			{
+				_pixelHalf = false;
+				pixel((uint16_t)((_pixelHigh << 8) | b));
+			}
+			return;
+		}
+		if (_argIndex < 4)
+			_args[_argIndex] = b;
+		_argIndex++;
+		if (_cmd == 0x2A && _argIndex == 4)
+		{
+			_xs = (_args[0] << 8) | _args[1];
+			_xe = (_args[2] << 8) | _args[3];
+		}
+		if (_cmd == 0x2B && _argIndex == 4)
+		{
+			_ys = (_args[0] << 8) | _args[1];
+			_ye = (_args[2] << 8) | _args[3];
+		}
+		if (_cmd == 0x36 && _argIndex == 1)
+			_madctl = b;
+	}
+
+	/*!
+		@brief FNV-1a hash of the GRAM, to compare screens
+		@return hash
+	*/
+	uint64_t hash(void) const
+	{
+		uint64_t h = 1469598103934665603ull;
+		for (int r = 0; r < PANEL_MODEL_ROWS; r++)
+			for (int c = 0; c < PANEL_MODEL_COLS; c++)
+			{
+				h ^= gram[r][c];
+				h *= 1099511628211ull;
+			}
+		return h;
+	}
+
+private:
+	void pixel(uint16_t color)
+	{
+		int row = (_madctl & 0x20) ? _cx : _cy;
+		int col = (_madctl & 0x20) ? _cy : _cx;
+		if (row >= 0 && row < PANEL_MODEL_ROWS && col >= 0 && col < PANEL_MODEL_COLS)
+			gram[row][col] = color;
+		if (++_cx > _xe)
+		{
+			_cx = _xs;
+			if (++_cy > _ye)
+				_cy = _ys;
+		}
+	}
+
+	uint8_t _shift = 0;
+	uint8_t _shiftBits = 0;
+	uint8_t _cmd = 0;
+	uint8_t _argIndex = 0;
+	uint8_t _args[4] = {};
+	uint8_t _madctl = 0;
+	bool _pixelHalf = false;
+	uint8_t _pixelHigh = 0;
+	int _xs = 0, _xe = 0, _ys = 0, _ye = 0, _cx = 0, _cy = 0;
+};
+
+extern PanelModel g_panel; /**< The one panel, all SDK stubs write to it */
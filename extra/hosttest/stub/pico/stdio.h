@@ -0,0 +1,9 @@
+/*!
+	@file     pico/stdio.h
+	@brief    Host stand in for the Pico SDK header.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
@@ -0,0 +1,34 @@
+/*!
+	@file     pico/stdlib.h
+	@brief    Host stand in for the Pico SDK header, GPIO writes go to the panel model.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include "../panel_model.hpp"
+
+typedef unsigned int uint;
+
+#define GPIO_OUT 1
+#define GPIO_IN 0
+
+enum gpio_function
+{
+	GPIO_FUNC_SPI = 1,
+	GPIO_FUNC_SIO = 5,
+	GPIO_FUNC_PIO0 = 6,
+	GPIO_FUNC_PIO1 = 7
+};
+
+inline void gpio_init(uint) {}
+inline void gpio_put(uint gpio, bool value) { g_panel.setPin((int8_t)gpio, value); }
+inline void gpio_set_dir(uint, bool) {}
+inline void gpio_set_function(uint, gpio_function) {}
+inline void busy_wait_ms(uint32_t) {}
+inline void busy_wait_us(uint64_t) {}
+inline void sleep_ms(uint32_t) {}
+inline bool stdio_init_all(void) { return true; }
+inline void tight_loop_contents(void) {}
@@ -12,6 +12,7 @@
 // Section Libraries
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
+#include "hardware/clocks.h"
 #include "ST7735_TFT_graphics.hpp"
 
 // Section:  Defines
@@ -131,6 +132,9 @@
 #define TFT_MILLISEC_DELAY busy_wait_ms
 #define TFT_MICROSEC_DELAY busy_wait_us
 
+// PIO software SPI
+#define TFT_PIO_SCLK_MAX_KHZ 32000 /**< PIO SPI clock with zero comm delay, 32Mhz as tested with HW SPI */
+
 /*!
 	@brief Class to control ST7735 TFT basic functionality.
 */
@@ -182,8 +186,8 @@ public:
 	void TFTSetupGPIO(int8_t, int8_t, int8_t, int8_t, int8_t);
 	void TFTInitScreenSize(uint8_t xOffset, uint8_t yOffset, uint16_t w, uint16_t h);
 	void TFTInitPCBType(TFT_PCBtype_e);
-	void TFTInitSPIType(uint32_t baudrate, spi_inst_t *spi);
-	void TFTInitSPIType(uint16_t CommDelay);
+	void TFTInitSPIType(uint32_t baudrate, spi_inst_t *spi, bool useDMA = true);
+	void TFTInitSPIType(uint16_t CommDelay, bool usePIO = true);
 	void TFTPowerDown(void);
 
 	void TFTsetRotation(TFT_rotate_e r);
@@ -199,6 +203,10 @@ public:
 private:
 	void TFTResetPIN(void);
 	void TFTSPIInitialize(void);
+	void TFTSoftwareSPIInitialize(void);
+	bool TFTPIOInitialize(void);
+	uint16_t TFTPIOClockDivider(void);
+	void TFTDMAInitialize(volatile void *txRegister, uint dreq);
 	void TFTST7735BInitialize(void);
 	void TFTGreenTabInitialize(void);
 	void TFTBlackTabInitialize(void);
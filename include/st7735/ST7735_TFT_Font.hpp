@@ -17,6 +17,81 @@
 #define _TFT_OPTIONAL_FONT_11 /**< Comment in to enable optional font 11*/
 #define _TFT_OPTIONAL_FONT_12 /**< Comment in to enable optional font 12*/
 
+#define TFT_FONT_BUILTIN 12	 /**< Fonts 1-12 in TFTFontTable */
+#define TFT_FONT_USER_MAX 4	 /**< Font numbers 13-16 are for TFTFontRegister */
+
+/*! How a font stores the bits of each glyph */
+enum TFT_Font_Layout_e : uint8_t
+{
+	TFTFontLayout_Scalable = 0, /**< one byte per column bit 0 at top, drawn with a size, like fonts 1-6 */
+	TFTFontLayout_Column = 1	/**< (height + 7) / 8 bytes per column bit 7 at top, like fonts 7-12 */
+};
+
+/*!
+	@brief Describes a fixed width font, glyphs are stored one after the other
+		in character order so a glyph is data + (character - offset) * bytes per glyph.
+*/
+struct TFT_Font_t
+{
+	const uint8_t *data;	  /**< Glyph data, nullptr if the font is not enabled */
+	uint8_t width;			  /**< Glyph width in pixels */
+	uint8_t height;			  /**< Glyph height in pixels */
+	uint8_t offset;			  /**< First character in the font */
+	uint8_t length;			  /**< Number of characters in the font */
+	TFT_Font_Layout_e layout; /**< How the glyph bits are stored */
+};
+
+extern const TFT_Font_t TFTFontTable[TFT_FONT_BUILTIN]; /**< Descriptors of fonts 1-12, index = font number - 1 */
+
+/*! One glyph of a proportional font, its box is the smallest that holds all its set pixels */
+struct TFT_Glyph_t
+{
+	uint16_t bitmapOffset; /**< Byte offset of the glyph's bits in TFT_PropFont_t bitmap */
+	uint8_t width;		   /**< Box width in pixels, 0 for a glyph with no set pixels like space */
+	uint8_t height;		   /**< Box height in pixels */
+	uint8_t xAdvance;	   /**< Pixels from this character's origin to the next one's */
+	int8_t xOffset;		   /**< Left bearing, origin to the box's left edge */
+	int8_t yOffset;		   /**< Top of the line to the box's top edge */
+};
+
+/*! Kerning pair of a proportional font */
+struct TFT_Kern_t
+{
+	uint8_t left;  /**< First character of the pair */
+	uint8_t right; /**< Character drawn after it */
+	int8_t adjust; /**< Added to the left character's xAdvance, negative moves the pair closer */
+};
+
+/*! How the boxes of a proportional font's glyphs are stored, each glyph starts on a byte */
+enum TFT_Glyph_encoding_e : uint8_t
+{
+	TFTGlyph_Bits = 0,  /**< one bit per pixel MSB first, row by row with no padding */
+	TFTGlyph_RLE = 1,	/**< row by row runs, each byte a background run (high nibble) then a set run (low nibble) of 0-15 pixels */
+	TFTGlyph_Gray2 = 2, /**< anti-aliased, 2 bits of coverage per pixel MSB first, 0 background to 3 all color */
+	TFTGlyph_Gray4 = 3  /**< anti-aliased, 4 bits of coverage per pixel MSB first, 0 background to 15 all color */
+};
+
+/*!
+	@brief Describes a proportional font, extra/fontcompiler makes them from BDF and PCF fonts.
+*/
+struct TFT_PropFont_t
+{
+	const uint8_t *bitmap;	   /**< Glyph bits */
+	const TFT_Glyph_t *glyphs; /**< Glyphs of characters first to last, then one for each of codes */
+	const TFT_Kern_t *kerning; /**< Kerning pairs sorted by left then right, nullptr if none */
+	uint16_t kernCount;		   /**< Number of kerning pairs */
+	uint8_t first;			   /**< First character of the dense range */
+	uint8_t last;			   /**< Last character of the dense range, below first if there is none */
+	uint8_t height;			   /**< Line height, every glyph box fits between 0 and height */
+	TFT_Glyph_encoding_e encoding; /**< How the glyph boxes are stored, TFTGlyph_Bits if left out */
+	const uint16_t *codes = nullptr; /**< Sorted code points outside first-last, found by binary search, nullptr if none */
+	uint16_t codeCount = 0;			 /**< Number of codes */
+};
+
+extern const TFT_PropFont_t TFTFontPropDefault; /**< Proportional 0x20-0x7E font made from font 1, with kerning, plus Latin-1, Greek and math symbols */
+extern const TFT_PropFont_t TFTFontPropBigNum;	/**< Proportional 0x2D-0x3A font made from font 7, RLE glyphs */
+extern const TFT_PropFont_t TFTFontPropBigNumAA;	/**< Proportional 0x2D-0x3A font, font 7 at half size, 4 bit anti-aliased */
+
 extern const unsigned char *pFontDefaultptr;	 /**< Pointer to default font data  */
 extern const unsigned char *pFontThickptr;		 /**< Pointer to thick font data  */
 extern const unsigned char *pFontSevenSegptr;	 /**< Pointer to seven segment font data  */
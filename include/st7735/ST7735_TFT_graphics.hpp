@@ -12,10 +12,40 @@
 #include <cstdio>
 #include <cstdlib>
 #include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
 #include "ST7735_TFT_Print.hpp"
+#include "ST7735_TFT_Font.hpp"
 
 // Section defines
 
+/*! Max pixels in one row of the ST7735 GRAM (132x162), sizes the DMA row buffers*/
+#define TFT_MAX_ROW_PIXELS 162
+
+/*! Max dirty rectangles tracked in framebuffer mode, when full the closest two are merged*/
+#define TFT_DIRTY_RECTS_MAX 4
+/*! Default shadow buffer merge gap in pixels, resending 3 pixels costs what a new address window does*/
+#define TFT_SHADOW_MERGE_GAP 3
+/*! Smallest tile width or height in tile mode*/
+#define TFT_TILE_MIN_SIZE 8
+/*! Max tiles on screen in tile mode, sizes the dirty tile bitset*/
+#define TFT_MAX_TILES (((TFT_MAX_ROW_PIXELS + TFT_TILE_MIN_SIZE - 1) / TFT_TILE_MIN_SIZE) * ((TFT_MAX_ROW_PIXELS + TFT_TILE_MIN_SIZE - 1) / TFT_TILE_MIN_SIZE))
+/*! Max tile buffers in the tile mode cache*/
+#define TFT_TILE_CACHE_MAX 16
+/*! Max slots in the glyph cache*/
+#define TFT_GLYPH_CACHE_MAX 16
+/*! Slots of the direct-mapped cache of code point lookups in a proportional font's sparse index, a power of 2*/
+#define TFT_GLYPH_INDEX_CACHE 16
+/*! Max characters TFTdrawText sends as one window, a row of the narrowest font*/
+#define TFT_TEXT_RUN_MAX ((TFT_MAX_ROW_PIXELS + 3) / 4)
+/*! Max args of one display list op, a proportional text run packs two characters per arg*/
+#define TFT_DISPLAY_OP_ARGS_MAX (5 + (TFT_TEXT_RUN_MAX + 1) / 2)
+/*! Background runs this long or longer, rows of a proportional text run with no glyph in them, skip the row buffer and go as one repeated color transfer*/
+#define TFT_PIXEL_RUN_REPEAT 32
+/*! Max vertices of TFTfillPolygon, sizes its edge table on the stack*/
+#define TFT_POLYGON_EDGES_MAX 32
+
 /*! Used in graphic shape methods*/
 #define _swap_TFT(a, b) \
 	{                   \
@@ -25,6 +55,15 @@
 		b = t;          \
 	}
 
+/*! Used in graphic shape methods, 32 bit values*/
+#define _swap_TFT32(a, b) \
+	{                     \
+		int32_t t;        \
+		t = a;            \
+		a = b;            \
+		b = t;            \
+	}
+
 /*! Enum to define a standard return code for most functions that return failures*/
 enum Display_Return_Codes_e : uint8_t
 {
@@ -46,7 +85,8 @@ enum Display_Return_Codes_e : uint8_t
 	Display_BufferNullptr = 15,          /**< The Buffer data array is an invalid pointer object*/
 	Display_ShapeScreenBounds = 16,		 /**< Shape is outside screen bounds, check x and y */
 	Display_IconScreenWidth = 17,        /**< Icon is greater than screen width , check width w value */
-	Display_GenericError = 18            /**< Generic Error */
+	Display_GenericError = 18,           /**< Generic Error */
+	Display_DisplayListFull = 19         /**< A draw call did not fit in the tile mode display list, it went straight to the panel*/
 };
 
 // Section: Classes
@@ -62,7 +102,7 @@ public:
 	~ST7735_TFT_graphics(){};
 
 	// Enums
-	/*! Font type 1-12 */
+	/*! Font type 1-12, 13-16 are user fonts added with TFTFontRegister */
 	enum TFT_Font_Type_e : uint8_t
 	{
 		TFTFont_Default = 1,	/**< Default Font, Full extended ASCII */
@@ -76,11 +116,24 @@ public:
 		TFTFont_ArialRound = 9, /**< Arial round font */
 		TFTFont_ArialBold = 10, /**< Arial bold font */
 		TFTFont_Mia = 11,		/**< Mia font */
-		TFTFont_Dedica = 12		/**< dedica font */
+		TFTFont_Dedica = 12,	/**< dedica font */
+		TFTFont_User1 = 13,		/**< User font 1 */
+		TFTFont_User2 = 14,		/**< User font 2 */
+		TFTFont_User3 = 15,		/**< User font 3 */
+		TFTFont_User4 = 16		/**< User font 4 */
+	};
+
+	/*! Which parts of a self crossing polygon TFTfillPolygon fills */
+	enum TFT_Fill_rule_e : uint8_t
+	{
+		TFTFill_EvenOdd = 0, /**< Inside where a ray crosses an odd number of edges */
+		TFTFill_NonZero = 1	 /**< Inside where the edges wind round a nonzero number of times */
 	};
 
 
 	virtual size_t write(uint8_t);
+	void TFTwaitIdle(void);
+	void TFTsetDMACallback(void (*callback)(void));
 	void TFTsetAddrWindow(uint8_t, uint8_t, uint8_t, uint8_t);
 	void TFTfillScreen(uint16_t color);
 	void TFTsetCursor(int16_t x, int16_t y);
@@ -100,13 +153,27 @@ public:
 
 	void TFTdrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
 	void TFTfillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+	void TFTdrawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color);
+	void TFTfillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color);
+	void TFTdrawArc(int16_t x0, int16_t y0, int16_t r, int16_t startAngle, int16_t endAngle, uint16_t color);
+	void TFTfillArc(int16_t x0, int16_t y0, int16_t r, int16_t thickness, int16_t startAngle, int16_t endAngle, uint16_t color);
 
 	void TFTdrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 	void TFTfillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+	Display_Return_Codes_e TFTfillPolygon(const int16_t *vertices, uint8_t count, uint16_t color, TFT_Fill_rule_e rule = TFTFill_EvenOdd, uint8_t fracBits = 0);
+
+	// Anti-aliased shapes
+	void TFTdrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg);
+	void TFTdrawCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg);
+	void TFTfillCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg);
+	Display_Return_Codes_e TFTfillPolygonAA(const int16_t *vertices, uint8_t count, uint16_t color, uint16_t bg, TFT_Fill_rule_e rule = TFTFill_EvenOdd, uint8_t fracBits = 0);
 
 	// Text
 	void TFTsetTextWrap(bool w);
 	void TFTFontNum(TFT_Font_Type_e FontNumber);
+	Display_Return_Codes_e TFTFontRegister(TFT_Font_Type_e FontNumber, const TFT_Font_t *font);
+	Display_Return_Codes_e TFTsetFont(const TFT_PropFont_t *font);
+	uint16_t TFTtextWidth(const char *pText);
 	Display_Return_Codes_e TFTdrawChar(uint8_t x, uint8_t y, uint8_t c, uint16_t color, uint16_t bg, uint8_t size);
 	Display_Return_Codes_e TFTdrawText(uint8_t x, uint8_t y, char *_text, uint16_t color, uint16_t bg, uint8_t size);
 	Display_Return_Codes_e TFTdrawChar(uint8_t x, uint8_t y, uint8_t c, uint16_t color, uint16_t bg);
@@ -114,25 +181,174 @@ public:
 	void setTextColor(uint16_t c);
 	void setTextColor(uint16_t c, uint16_t bg);
 	void setTextSize(uint8_t s);
+	Display_Return_Codes_e TFTsetGlyphCache(uint16_t *buffer, uint32_t sizePixels, uint8_t slots);
+	void TFTglyphCacheClear(void);
+	uint32_t TFTglyphCacheHits(void);
+	uint32_t TFTglyphCacheMisses(void);
 
 	// Bitmap & Icon
 	Display_Return_Codes_e TFTdrawIcon(uint8_t x, uint8_t y, uint8_t w, uint16_t color, uint16_t bgcolor, const unsigned char character[]);
 	Display_Return_Codes_e TFTdrawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bgcolor, uint8_t *pBmp, uint16_t sizeOfBitmap);
 	Display_Return_Codes_e TFTdrawBitmap24Data(uint8_t x, uint8_t y, uint8_t *pBmp, uint8_t w, uint8_t h);
 	Display_Return_Codes_e TFTdrawBitmap16Data(uint8_t x, uint8_t y, uint8_t *pBmp, uint8_t w, uint8_t h);
+	Display_Return_Codes_e TFTdrawBitmap565Data(uint8_t x, uint8_t y, const uint16_t *pBmp, uint8_t w, uint8_t h);
 	Display_Return_Codes_e TFTdrawSpriteData(uint8_t x, uint8_t y, uint8_t *pBmp, uint8_t w, uint8_t h, uint16_t backgroundColor);
 
+	// Framebuffer
+	Display_Return_Codes_e TFTsetFrameBuffer(uint16_t *buffer, uint32_t sizePixels);
+	Display_Return_Codes_e TFTsetFrameBufferIndexed(uint8_t *buffer, uint32_t sizeBytes, uint8_t bitsPerPixel, const uint16_t *palette);
+	Display_Return_Codes_e TFTsetPalette(const uint16_t *palette);
+	Display_Return_Codes_e TFTsetTileMode(uint16_t *tileCache, uint8_t tileCount, uint8_t tileWidth, uint8_t tileHeight, uint8_t *displayList, uint16_t displayListSize);
+	Display_Return_Codes_e TFTsetBandMode(uint16_t *bandBuffer, uint8_t bandCount, uint8_t bandRows, uint8_t *displayList, uint16_t displayListSize);
+	Display_Return_Codes_e TFTsetShadowBuffer(void *shadow, uint32_t sizeBytes, uint8_t mergeGap = TFT_SHADOW_MERGE_GAP);
+	int32_t TFTflushBytesSaved(void);
+	void TFTframeBufferOff(void);
+	Display_Return_Codes_e TFTflush(void);
+
 protected:
+	/*! Where draw calls end up*/
+	enum TFT_RAM_mode_e : uint8_t
+	{
+		TFTRAM_Direct = 0,		/**< Straight to the panel */
+		TFTRAM_FrameBuffer = 1, /**< Full screen RGB565 framebuffer, TFTsetFrameBuffer */
+		TFTRAM_Tiles = 2		/**< Display list re-rasterized into cached tiles, TFTsetTileMode */
+	};
+
+	/*! What a pixel stream written to RAM points at*/
+	enum TFT_RAM_source_e : uint8_t
+	{
+		TFTRAMSource_Pixels = 0, /**< RGB565 pixels */
+		TFTRAMSource_Bytes = 1,	 /**< RGB565 pixels as big endian byte pairs, as sent on the wire */
+		TFTRAMSource_Color = 2	 /**< One color repeated */
+	};
+
+	/*! Draw methods recorded in the display list, one per op*/
+	enum TFT_DisplayOp_e : uint8_t
+	{
+		TFTOp_Pixel = 0,	   /**< x y color */
+		TFTOp_FillRect,		   /**< x y w h color */
+		TFTOp_Line,			   /**< x0 y0 x1 y1 color */
+		TFTOp_Circle,		   /**< x y r color */
+		TFTOp_FillCircle,	   /**< x y r color */
+		TFTOp_RoundRect,	   /**< x y w h r color */
+		TFTOp_FillRoundRect,   /**< x y w h r color */
+		TFTOp_Triangle,		   /**< x0 y0 x1 y1 x2 y2 color */
+		TFTOp_FillTriangle,	   /**< x0 y0 x1 y1 x2 y2 color */
+		TFTOp_Ellipse,		   /**< x y rx ry color */
+		TFTOp_FillEllipse,	   /**< x y rx ry color */
+		TFTOp_Arc,			   /**< x y r start end color */
+		TFTOp_FillArc,		   /**< x y r thickness start end color */
+		TFTOp_LineAA,		   /**< x0 y0 x1 y1 color bg */
+		TFTOp_CircleAA,		   /**< x y r color bg */
+		TFTOp_FillCircleAA,	   /**< x y r color bg */
+		TFTOp_Char,			   /**< x y character color bg size font, fonts 1-6 */
+		TFTOp_CharBig,		   /**< x y character color bg font, fonts 7-12 */
+		TFTOp_Icon,			   /**< x y w color bg + data pointer, ops from here on carry one */
+		TFTOp_Bitmap,		   /**< x y w h color bg size + data pointer */
+		TFTOp_Bitmap16,		   /**< x y w h + data pointer */
+		TFTOp_Bitmap565,	   /**< x y w h + data pointer */
+		TFTOp_Bitmap24,		   /**< x y w h + data pointer */
+		TFTOp_Sprite,		   /**< x y w h bg + data pointer */
+		TFTOp_Polygon,		   /**< count color rule fracBits + vertices pointer */
+		TFTOp_PolygonAA,	   /**< count color bg rule fracBits + vertices pointer */
+		TFTOp_TextProp		   /**< x y color bg count, characters two per arg + proportional font pointer */
+	};
+
 	void pushColor(uint16_t color);
 	uint16_t Color565(uint16_t, uint16_t, uint16_t);
+	void drawLineRun(int16_t x, int16_t y, int16_t end, bool vertical, uint16_t color);
+	void circleRuns(int16_t x0, int16_t y0, int16_t r, uint8_t corners, bool axes, uint16_t color, int16_t *table);
+	void ellipseRuns(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color, int16_t *table);
+	void quadrantRuns(int16_t x0, int16_t y0, int16_t a, int16_t b, int16_t d, uint8_t corners, uint16_t color, int16_t *table);
+	void quadrantRun(int16_t x0, int16_t y0, int16_t a, int16_t b, int16_t d, bool vertical, uint8_t corners, uint16_t color, int16_t *table);
+	int16_t *spanTableClear(int16_t *table);
+	void fillSpans(int16_t x0, const int16_t *outer, const int16_t *inner, uint16_t color, int16_t middle = 0);
+	void arcFilterSet(int16_t x0, int16_t y0, int16_t startAngle, int16_t endAngle);
+	bool arcFilterInside(int16_t x, int16_t y);
+	/*! Where a glyph's bits are in its font data, fonts 1-6 and 7-12 are stored differently*/
+	struct GlyphBits_t
+	{
+		const uint8_t *data;	/**< first byte of the glyph, column by column*/
+		uint8_t bytesPerColumn; /**< bytes per glyph column*/
+		uint8_t columns;		/**< columns in the data, any further column is spacing*/
+		bool msbTop;			/**< true if bit 7 is the top pixel of a byte, else bit 0*/
+		uint8_t size;			/**< scale, each bit drawn size x size*/
+	};
+	bool glyphCacheSend(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t character, uint16_t color, uint16_t bg, uint8_t size);
+	void glyphDraw(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const GlyphBits_t &bits, uint8_t character, uint16_t color, uint16_t bg);
+	void glyphExpandRow(const GlyphBits_t &bits, uint8_t row, uint16_t *dest, uint8_t w, uint16_t color, uint16_t bg);
+	bool glyphLookup(uint8_t character, uint8_t size, GlyphBits_t &bits);
+	bool textRunsActive(uint16_t color, uint16_t bg);
+	Display_Return_Codes_e textRunDraw(uint8_t x, uint8_t y, const char *pText, uint8_t count, uint8_t advance, uint16_t color, uint16_t bg, uint8_t size);
+	const TFT_Glyph_t *propGlyph(uint16_t code);
+	int8_t propKern(uint16_t left, uint16_t right);
+	uint8_t utf8Decode(const char *pText, uint8_t length, uint16_t &code);
+	bool propCharPrint(uint16_t code, const char *pBytes, uint8_t length);
+	Display_Return_Codes_e propTextDraw(uint8_t x, uint8_t y, const char *pText, uint8_t count, uint16_t color, uint16_t bg);
+	uint8_t propBitsPerPixel(void);
+	void propExpandRow(const TFT_Glyph_t &glyph, int16_t row, uint16_t *dest, int16_t left, uint16_t w, const uint16_t *ramp);
+	/*! Decoder position in one RLE glyph, its rows are read top to bottom*/
+	struct RunCursor_t
+	{
+		const uint8_t *data; /**< next code byte*/
+		uint16_t index; /**< box pixel the pending set run starts at*/
+		uint8_t set; /**< set pixels pending at index*/
+	};
+	bool propRunNext(const TFT_Glyph_t &glyph, RunCursor_t &cursor, uint8_t row, uint8_t &start, uint8_t &end);
+	/*! Decoded pixels waiting in a row buffer to be sent*/
+	struct PixelStream_t
+	{
+		uint16_t *buffer; /**< row buffer being filled, nullptr when none*/
+		uint16_t used; /**< pixels in buffer*/
+	};
+	void pixelStreamPut(PixelStream_t &stream, uint16_t color, uint32_t count);
+	uint16_t *pixelStreamReserve(PixelStream_t &stream, uint16_t count);
+	void pixelStreamFlush(PixelStream_t &stream);
+	void wuLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, uint16_t bg);
+	void circleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg, int16_t *table);
+	void circlePlotAA(int16_t x0, int16_t y0, int16_t dx, int16_t dy, uint16_t color, uint16_t bg, uint8_t alpha);
+	void blendPixel(int32_t x, int32_t y, uint16_t color, uint16_t bg, uint8_t alpha);
+	uint16_t blend565(uint16_t color, uint16_t bg, uint8_t alpha);
+	uint32_t squareRoot(uint32_t value);
 	void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color);
-	void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color);
+	void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, int16_t width, int16_t delta, uint16_t color);
 
 	void writeCommand(uint8_t);
 	void writeData(uint8_t);
 	void spiWrite(uint8_t);
 	void spiWriteSoftware(uint8_t spidata);
 	void spiWriteDataBuffer(uint8_t *spidata, uint32_t len);
+	void spiWriteBytes(const uint8_t *spidata, uint32_t len);
+	void spiWriteCommandBytes(uint8_t command, const uint8_t *data, uint8_t len);
+	void spiWriteDataBufferAsync(const uint8_t *spidata, uint32_t len);
+	void spiWritePixelBufferAsync(const uint16_t *pixels, uint32_t count);
+	void spiWriteColorRepeatAsync(uint16_t color, uint32_t count);
+	void spiSetFrameBits(uint8_t bits);
+	void dmaSetReadIncrement(bool increment);
+	void fillRectSolid(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color);
+	void addrWindowInvalidate(void);
+	void pioWaitIdle(void);
+	uint16_t *rowBufferNext(void);
+	bool ramTargetRun(uint32_t &count, uint32_t &offset);
+	void ramTargetWrite(const void *source, TFT_RAM_source_e kind, uint32_t count);
+	void ramTargetPut(uint32_t offset, uint16_t color);
+	uint16_t ramTargetGet(uint32_t offset);
+	uint8_t paletteIndex(uint16_t color);
+	void paletteExpand(uint16_t *row, uint32_t offset, uint8_t count);
+	void ramTargetWaitIdle(void);
+	void frameBufferMarkDirty(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+	void frameBufferFlush(void);
+	uint16_t frameBufferPixel(const void *buffer, uint32_t offset);
+	void frameBufferSendSpan(uint8_t x0, uint8_t x1, uint8_t y);
+	void tileFlush(void);
+	void tileTarget(uint8_t slot);
+	bool displayListActive(void);
+	void displayListRecord(TFT_DisplayOp_e op, const int16_t *args, uint8_t argc, const void *data, int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool opaque);
+	void displayListRender(uint16_t start);
+	void displayOpDraw(TFT_DisplayOp_e op, const int16_t *args, const void *data);
+	void displayListOverflow(TFT_DisplayOp_e op, const int16_t *args, const void *data, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+	uint16_t displayOpLength(uint8_t op, uint8_t argc);
+	void ramModeRotated(void);
 
 	bool _wrap = true;				/**< wrap text around the screen on overflow*/
 	uint16_t _textcolor = 0xFFFF;	/**< ForeGround color for text*/
@@ -163,6 +379,145 @@ protected:
 	spi_inst_t *_pspiInterface;	  /**< SPI instance pointer*/
 	uint16_t _speedSPIKHz;		  /**< SPI speed value in kilohertz*/
 	uint16_t _SWSPIGPIODelay = 0; /**< uS GPIO Communications delay, SW SPI ONLY */
+	bool _usePIO = true;		  /**< True to run software SPI on a PIO state machine, SW SPI ONLY */
+	PIO _pio = nullptr;			  /**< PIO instance running software SPI, nullptr = GPIO bit bang*/
+	int8_t _pioSM = -1;			  /**< PIO state machine running software SPI*/
+	uint8_t _pioOffset = 0;		  /**< PIO program offset in instruction memory*/
+
+	bool _useDMA = true;		/**< True to stream pixel data by DMA when hardware SPI selected*/
+	int _dmaChannel = -1;		/**< DMA channel claimed for SPI TX, -1 = none, blocking writes used*/
+	bool _dmaBusy = false;		/**< True while a DMA transfer is in flight and holds CS low*/
+	const void *_dmaSource = nullptr; /**< Buffer the DMA transfer in flight reads from*/
+	bool _dmaReadIncrement = true; /**< DMA read increment, off while streaming a repeated fill color*/
+	uint16_t _dmaFillColor = 0; /**< Source word for repeated color DMA fills*/
+	uint8_t _spiFrameBits = 8;	/**< Current SPI frame size, 8 for commands, 16 for RGB565 pixel data*/
+	void (*_dmaCallback)(void) = nullptr; /**< User function called from IRQ when a DMA transfer completes*/
+	uint16_t _rowBuffer[2][TFT_MAX_ROW_PIXELS]; /**< Ping-pong RGB565 row buffers, one is filled while the other is on the wire*/
+	uint8_t _rowBufferIndex = 0;	/**< Index of the row buffer last handed out by rowBufferNext*/
+
+	/*! Last address window sent to the panel, lets TFTsetAddrWindow skip redundant CASET/RASET*/
+	struct AddrWindowCache_t
+	{
+		bool valid;				/**< colStart..rowEnd hold what the panel has programmed*/
+		bool ramWriteActive;	/**< RAMWR sent and no other command since, pixelsWritten is the RAM pointer*/
+		uint8_t colStart;		/**< CASET start incl. offset*/
+		uint8_t colEnd;			/**< CASET end incl. offset*/
+		uint8_t rowStart;		/**< RASET start incl. offset*/
+		uint8_t rowEnd;			/**< RASET end incl. offset*/
+		uint32_t pixelsWritten; /**< pixels sent since RAMWR*/
+	} _addrWindow = {false, false, 0, 0, 0, 0, 0}; /**< Address window cache*/
+
+	/*! Sector of the arc being drawn, drawLineRun keeps only the pixels inside it*/
+	struct ArcFilter_t
+	{
+		bool active;	/**< an arc is being drawn*/
+		bool wide;		/**< sweep over 180 degrees, inside either half plane*/
+		int16_t x0;		/**< center x*/
+		int16_t y0;		/**< center y*/
+		int32_t startX; /**< start direction * 1024*/
+		int32_t startY; /**< start direction * 1024*/
+		int32_t endX;	/**< end direction * 1024*/
+		int32_t endY;	/**< end direction * 1024*/
+	} _arcFilter = {false, false, 0, 0, 0, 0, 0, 0}; /**< Arc sector*/
+
+	TFT_RAM_mode_e _ramMode = TFTRAM_Direct; /**< Draw straight to the panel or to RAM*/
+	void *_frameBuffer = nullptr; /**< User RAM framebuffer, _widthTFT*_heightTFT pixels*/
+	uint8_t _frameBufferBits = 16; /**< Bits per framebuffer pixel, 16 = RGB565, 8 4 or 2 = palette index*/
+	const uint16_t *_palette = nullptr; /**< User palette of the indexed framebuffer, 1 << _frameBufferBits RGB565 entries*/
+	uint16_t _paletteLastColor = 0; /**< Last color looked up in the palette*/
+	uint8_t _paletteLastIndex = 0; /**< Palette index of _paletteLastColor*/
+	/*! RAM buffer pixel writes currently go to, a screen area stored row by row*/
+	struct RamTarget_t
+	{
+		void *buffer;	  /**< w*h pixels, nullptr = pixel writes go to the panel*/
+		uint8_t x;		  /**< screen column of the first pixel*/
+		uint8_t y;		  /**< screen row of the first pixel*/
+		uint8_t w;		  /**< width, also the row stride*/
+		uint8_t h;		  /**< height*/
+		uint8_t bits;	  /**< bits per pixel, 16 = RGB565, 8 4 or 2 = palette index*/
+	} _ramTarget = {nullptr, 0, 0, 0, 0, 16}; /**< Current RAM target, framebuffer or a tile*/
+	/*! RAM mode address window, the RAM copy of the panel's window and RAM pointer*/
+	struct FrameWindow_t
+	{
+		bool valid;		/**< window overlaps the RAM target, pixels written to an invalid window are dropped*/
+		uint8_t x0;		/**< window left column*/
+		uint8_t y0;		/**< window top row*/
+		uint8_t x1;		/**< window right column*/
+		uint8_t y1;		/**< window bottom row*/
+		uint8_t x;		/**< column of the next pixel written*/
+		uint8_t y;		/**< row of the next pixel written*/
+	} _fbWindow = {false, 0, 0, 0, 0, 0, 0}; /**< Framebuffer address window*/
+	/*! Rectangle of the framebuffer changed since the last TFTflush, inclusive co-ords*/
+	struct DirtyRect_t
+	{
+		uint8_t x0; /**< left column*/
+		uint8_t y0; /**< top row*/
+		uint8_t x1; /**< right column*/
+		uint8_t y1; /**< bottom row*/
+	} _dirtyRects[TFT_DIRTY_RECTS_MAX]; /**< Dirty rectangles, disjoint and not touching*/
+	uint8_t _dirtyRectCount = 0; /**< Number of entries used in _dirtyRects*/
+	void shadowDiffRect(const DirtyRect_t &rect);
+	void shadowUpdate(void);
+	void *_shadowBuffer = nullptr; /**< User copy of what the panel shows, framebuffer format, nullptr = off*/
+	uint8_t _shadowMergeGap = TFT_SHADOW_MERGE_GAP; /**< Unchanged pixels between spans that are still sent as one*/
+	bool _shadowValid = false; /**< Shadow matches the panel, false until the first full flush*/
+	int32_t _flushBytesSaved = 0; /**< Bytes the last flush saved with the shadow*/
+
+	uint8_t *_displayList = nullptr; /**< User buffer of recorded draw ops, tile mode*/
+	uint16_t _displayListSize = 0;	 /**< Size of _displayList in bytes*/
+	uint16_t _displayListUsed = 0;	 /**< Bytes of _displayList in use*/
+	bool _displayListReplay = false; /**< True while ops are drawn from the list, so they are not recorded again*/
+	bool _displayListOverflow = false; /**< A draw call did not fit in the list, _displayListLost is not in it*/
+	DirtyRect_t _displayListLost = {0, 0, 0, 0}; /**< Bounds of the calls drawn straight to the panel since the list last covered them*/
+	/*! Header of one recorded op, followed by argc int16_t args and for ops >= TFTOp_Icon a data pointer*/
+	struct DisplayOp_t
+	{
+		uint8_t op;	  /**< TFT_DisplayOp_e*/
+		uint8_t argc; /**< number of int16_t args*/
+		uint8_t x0;	  /**< bounds on screen, inclusive*/
+		uint8_t y0;	  /**< bounds on screen, inclusive*/
+		uint8_t x1;	  /**< bounds on screen, inclusive*/
+		uint8_t y1;	  /**< bounds on screen, inclusive*/
+	};
+
+	uint16_t *_tileCache = nullptr; /**< User buffer of _tileCount tiles of _tileWidth*_tileHeight pixels*/
+	uint8_t _tileCount = 0;			/**< Number of tile buffers in the cache*/
+	uint8_t _tileWidth = 16;		/**< Tile width in pixels*/
+	uint8_t _tileHeight = 16;		/**< Tile height in pixels*/
+	uint32_t _tileClock = 0;		/**< Use counter for least recently used tile replacement*/
+	/*! One polygon edge in TFTfillPolygon, top to bottom, 16.16 fixed point*/
+	struct PolygonEdge_t
+	{
+		int32_t yTop;	 /**< top y, the edge covers yTop <= y < yBottom*/
+		int32_t yBottom; /**< bottom y*/
+		int32_t xTop;	 /**< x at yTop*/
+		int32_t slope;	 /**< x step per 1.0 of y*/
+		int8_t winding;	 /**< +1 drawn downward, -1 upward*/
+	};
+
+	/*! One tile buffer of the cache*/
+	struct TileSlot_t
+	{
+		int16_t tile;	  /**< tile index held, -1 = empty*/
+		uint32_t lastUse; /**< _tileClock at last use*/
+	} _tileSlots[TFT_TILE_CACHE_MAX]; /**< Tile cache contents*/
+	uint16_t *_glyphCache = nullptr;  /**< User glyph cache, _glyphSlotCount slots of _glyphSlotPixels RGB565 pixels*/
+	uint32_t _glyphSlotPixels = 0;	  /**< Pixels per glyph cache slot*/
+	uint8_t _glyphSlotCount = 0;	  /**< Glyph cache slots, 0 = off*/
+	uint32_t _glyphClock = 0;		  /**< Use counter for least recently used glyph replacement*/
+	uint32_t _glyphHits = 0;		  /**< Characters sent from the glyph cache*/
+	uint32_t _glyphMisses = 0;		  /**< Cacheable characters decoded into the glyph cache*/
+	/*! One glyph cache entry, its key and last use*/
+	struct GlyphSlot_t
+	{
+		uint8_t font;	  /**< font number, 0 = empty*/
+		uint8_t character; /**< ASCII character*/
+		uint8_t size;	  /**< font 1-6 size*/
+		uint16_t color;	  /**< foreground*/
+		uint16_t bg;	  /**< background*/
+		uint32_t lastUse; /**< _glyphClock at last use*/
+	} _glyphSlots[TFT_GLYPH_CACHE_MAX]; /**< Glyph cache contents*/
+	uint32_t _dirtyTiles[(TFT_MAX_TILES + 31) / 32] = {0}; /**< Bitset of tiles changed since the last flush*/
 private:
 	/*! Width of the font in bits each representing a bytes sized column*/
 	enum TFT_Font_width_e : uint8_t
@@ -209,6 +564,19 @@ private:
 	uint8_t _CurrentFontoffset = 0;	  /**< Store current offset width */
 	uint8_t _CurrentFontheight = 8;	  /**< Store current offset height */
 	uint8_t _CurrentFontLength = 254; /**<Store current font number of characters */
+	const TFT_Font_t *_font = &TFTFontTable[0];		   /**< Descriptor of the current font */
+	const TFT_Font_t *_fontUser[TFT_FONT_USER_MAX] = {}; /**< Registered user fonts 13-16 */
+	const TFT_PropFont_t *_propFont = nullptr;		   /**< Proportional font set by TFTsetFont, nullptr for fonts 1-16 */
+	uint16_t _kernLeft = 0;							   /**< Character print last drew on this line, for kerning */
+	char _utf8Pending[4] = {};						   /**< Bytes of a UTF-8 sequence print has not finished */
+	uint8_t _utf8Count = 0;							   /**< Bytes in _utf8Pending */
+	/*! One code point looked up in the proportional font's sparse index*/
+	struct GlyphIndexSlot_t
+	{
+		uint16_t code;	/**< code point, 0 = empty*/
+		uint16_t glyph; /**< index into glyphs, UINT16_MAX if the font does not have it*/
+	} _glyphIndex[TFT_GLYPH_INDEX_CACHE] = {}; /**< Direct-mapped on the low bits of the code point*/
+	const TFT_PropFont_t *_glyphIndexFont = nullptr;   /**< Font the _glyphIndex slots are for*/
 };
 
 // ********************** EOF *********************
@@ -8,6 +8,7 @@
 */
 
 #include "../../include/st7735/ST7735_TFT.hpp"
+#include "ST7735_TFT_spi.pio.h"
  
 /*!
 	@brief Constructor for class ST7735_TFT
@@ -24,22 +25,129 @@ void ST7735_TFT::TFTSPIInitialize(void)
 	TFT_SDATA_SPI_FUNC;
 	TFT_SCLK_SPI_FUNC;
 
-    // Set SPI format
+    // Set SPI format, 8 bit for commands, switched to 16 bit for pixel data
+    _spiFrameBits = 8;
     spi_set_format( _pspiInterface,   // SPI instance
                     8,      // Number of bits per transfer
                     SPI_CPOL_0,      // Polarity (CPOL)
                     SPI_CPHA_0,      // Phase (CPHA)
                     SPI_MSB_FIRST);
 
+	TFTDMAInitialize(&spi_get_hw(_pspiInterface)->dr, spi_get_dreq(_pspiInterface, true));
+}
+
+/*!
+	@brief : Claim a DMA channel to feed the SPI TX FIFO
+	@param txRegister FIFO register the DMA writes to, SPI data register or PIO TX FIFO
+	@param dreq data request signal that paces the DMA
+	@note if no channel is free, blocking writes are used
+*/
+void ST7735_TFT::TFTDMAInitialize(volatile void *txRegister, uint dreq)
+{
+	if (_useDMA == true && _dmaChannel < 0)
+		_dmaChannel = dma_claim_unused_channel(false);
+	if (_dmaChannel >= 0)
+	{
+		dma_channel_config dmaConfig = dma_channel_get_default_config(_dmaChannel);
+		channel_config_set_transfer_data_size(&dmaConfig, DMA_SIZE_8);
+		channel_config_set_read_increment(&dmaConfig, true);
+		_dmaReadIncrement = true;
+		channel_config_set_write_increment(&dmaConfig, false);
+		channel_config_set_dreq(&dmaConfig, dreq);
+		dma_channel_configure(_dmaChannel, &dmaConfig, txRegister, nullptr, 0, false);
+	}
+}
+
+/*!
+	@brief : Init Software SPI, PIO state machine if one is free else GPIO bit bang
+*/
+void ST7735_TFT::TFTSoftwareSPIInitialize(void)
+{
+	if (TFTPIOInitialize() == true)
+		return;
+	TFT_SCLK_SetLow;
+	TFT_SDATA_SetLow;
+	TFT_SCLK_SetDigitalOutput;
+	TFT_SDATA_SetDigitalOutput;
+}
+
+/*!
+	@brief : Load the SPI program onto a free PIO state machine, clock and data on any GPIO
+	@return true if running , false if disabled or no PIO state machine or memory free
+*/
+bool ST7735_TFT::TFTPIOInitialize(void)
+{
+	if (_usePIO == false)
+		return false;
+	if (_pio == nullptr)
+	{
+		PIO pioBlocks[2] = {pio0, pio1};
+		for (PIO pio : pioBlocks)
+		{
+			if (pio_can_add_program(pio, &st7735_spi_program) == false)
+				continue;
+			int sm = pio_claim_unused_sm(pio, false);
+			if (sm < 0)
+				continue;
+			_pio = pio;
+			_pioSM = sm;
+			_pioOffset = pio_add_program(pio, &st7735_spi_program);
+			break;
+		}
+		if (_pio == nullptr)
+		{
+			printf("Error TFTPIOInitialize 1: No free PIO, using GPIO software SPI\r\n");
+			return false;
+		}
+	}
+	_spiFrameBits = 8;
+	st7735_spi_program_init(_pio, _pioSM, _pioOffset, _TFT_SDATA, _TFT_SCLK, TFTPIOClockDivider());
+	TFTDMAInitialize(&_pio->txf[_pioSM], pio_get_dreq(_pio, _pioSM, true));
+	return true;
+}
+
+/*!
+	@brief : PIO clock divider from the SW SPI GPIO delay
+	@return divider, 2 cycles per bit so SCLK = clk_sys / (2 * divider)
+	@note 0 delay runs at TFT_PIO_SCLK_MAX_KHZ, otherwise each clock phase lasts
+		the delay in uS as in the GPIO bit bang version.
+*/
+uint16_t ST7735_TFT::TFTPIOClockDivider(void)
+{
+	uint32_t sysHz = clock_get_hz(clk_sys);
+	uint32_t divider;
+	if (_SWSPIGPIODelay == 0)
+		divider = (sysHz + (2 * TFT_PIO_SCLK_MAX_KHZ * 1000) - 1) / (2 * TFT_PIO_SCLK_MAX_KHZ * 1000);
+	else
+		divider = (sysHz / 1000000) * _SWSPIGPIODelay;
+	if (divider < 1)
+		divider = 1;
+	if (divider > 0xFFFF)
+		divider = 0xFFFF;
+	return divider;
 }
 
 /*!
 	@brief: Call when powering down TFT
-	@note  Will switch off SPI 
+	@note  Will switch off SPI and release the DMA channel and PIO state machine
 */
 void ST7735_TFT ::TFTPowerDown(void)
 {
 	TFTchangeMode(TFT_Display_off_mode);
+	TFTwaitIdle();
+	if (_dmaChannel >= 0)
+	{
+		TFTsetDMACallback(nullptr);
+		dma_channel_unclaim(_dmaChannel);
+		_dmaChannel = -1;
+	}
+	if (_pio != nullptr)
+	{
+		pio_sm_set_enabled(_pio, _pioSM, false);
+		pio_remove_program(_pio, &st7735_spi_program, _pioOffset);
+		pio_sm_unclaim(_pio, _pioSM);
+		_pio = nullptr;
+	}
 	TFT_DC_SetLow;
 	TFT_RST_SetLow;
 	TFT_SCLK_SetLow;
@@ -94,11 +202,9 @@ void ST7735_TFT ::TFTGreenTabInitialize() {
 	TFT_DC_SetDigitalOutput;
 	TFT_CS_SetHigh;
 	TFT_CS_SetDigitalOutput;
-if (_hardwareSPI == false){
-	TFT_SCLK_SetLow;
-	TFT_SDATA_SetLow;
-	TFT_SCLK_SetDigitalOutput;
-	TFT_SDATA_SetDigitalOutput;
+if (_hardwareSPI == false)
+{
+	TFTSoftwareSPIInitialize();
 }else{
 	TFTSPIInitialize();
 }
@@ -135,10 +241,7 @@ void ST7735_TFT ::TFTRedTabInitialize() {
 	TFT_CS_SetDigitalOutput;
 if (_hardwareSPI == false)
 {
-	TFT_SCLK_SetLow;
-	TFT_SDATA_SetLow;
-	TFT_SCLK_SetDigitalOutput;
-	TFT_SDATA_SetDigitalOutput;
+	TFTSoftwareSPIInitialize();
 }else{
 	TFTSPIInitialize();
 }
@@ -160,10 +263,7 @@ void ST7735_TFT ::TFTBlackTabInitialize() {
 	TFT_CS_SetDigitalOutput;
 if (_hardwareSPI == false)
 {
-	TFT_SCLK_SetLow;
-	TFT_SDATA_SetLow;
-	TFT_SCLK_SetDigitalOutput;
-	TFT_SDATA_SetDigitalOutput;
+	TFTSoftwareSPIInitialize();
 }else{
 	TFTSPIInitialize();
 }
@@ -186,10 +286,7 @@ void ST7735_TFT ::TFTST7735BInitialize() {
 	TFT_CS_SetDigitalOutput;
 if (_hardwareSPI == false)
 {
-	TFT_SCLK_SetLow;
-	TFT_SDATA_SetLow;
-	TFT_SCLK_SetDigitalOutput;
-	TFT_SDATA_SetDigitalOutput;
+	TFTSoftwareSPIInitialize();
 }else{
 	TFTSPIInitialize();
 }
@@ -456,6 +553,7 @@ void ST7735_TFT ::TFTchangeMode(TFT_modes_e mode) {
 void ST7735_TFT ::TFTsetRotation(TFT_rotate_e mode) {
 	uint8_t madctl = 0;
 	uint8_t rotation;
+	TFTflush(); // framebuffer layout follows the rotation, send it before it changes
 	rotation = mode % 4;
 	switch (rotation) {
 		case TFT_Degrees_0 :
@@ -507,6 +605,7 @@ void ST7735_TFT ::TFTsetRotation(TFT_rotate_e mode) {
 	}
 	writeCommand(ST7735_MADCTL);
 	writeData(madctl);
+	ramModeRotated();
 }
 
 /*!
@@ -550,24 +649,29 @@ void ST7735_TFT  ::TFTInitPCBType(TFT_PCBtype_e pcbType)
 	@brief intialise HW SPI setup
 	@param speed_Khz SPI baudrate in Khz , 1000 = 1 Mhz
 	@param spi_interface Spi interface, spi0 spi1 etc
+	@param useDMA true(default) stream bitmap and fill data by DMA, false blocking writes only
 	@note method overload used , method 1 hardware SPI 
 */
-void ST7735_TFT  :: TFTInitSPIType(uint32_t speed_Khz,  spi_inst_t* spi_interface) 
+void ST7735_TFT  :: TFTInitSPIType(uint32_t speed_Khz,  spi_inst_t* spi_interface, bool useDMA) 
 {
 	 _pspiInterface = spi_interface;
 	_speedSPIKHz = speed_Khz;
 	_hardwareSPI = true;
+	_useDMA = useDMA;
 }
 
 /*!
 	@brief intialise SW SPI set
 	@param CommDelay SW SPI GPIO delay
-	@note method overload used , method 2 software SPI 
+	@param usePIO true(default) run SPI on a PIO state machine, fed by FIFO & DMA.
+		false or no free state machine, GPIO bit bang.
+	@note method overload used , method 2 software SPI, clock and data on any GPIO.
 */
-void ST7735_TFT ::TFTInitSPIType(uint16_t CommDelay) 
+void ST7735_TFT ::TFTInitSPIType(uint16_t CommDelay, bool usePIO) 
 {
 	TFTSwSpiGpioDelaySet(CommDelay);
 	_hardwareSPI = false;
+	_usePIO = usePIO;
 }
 
 /*!
@@ -585,6 +689,12 @@ uint16_t ST7735_TFT::TFTSwSpiGpioDelayGet(void){return _SWSPIGPIODelay;}
 /*!
 	@brief Freq delay used in SW SPI setter, uS delay used in SW SPI method
 	@param CommDelay The GPIO communications delay in uS
+	@note with PIO software SPI this sets the state machine clock divider
 */
-void  ST7735_TFT::TFTSwSpiGpioDelaySet(uint16_t CommDelay){_SWSPIGPIODelay = CommDelay;}
+void  ST7735_TFT::TFTSwSpiGpioDelaySet(uint16_t CommDelay)
+{
+	_SWSPIGPIODelay = CommDelay;
+	if (_pio != nullptr)
+		pio_sm_set_clkdiv_int_frac(_pio, _pioSM, TFTPIOClockDivider(), 0);
+}
 //**************** EOF *****************
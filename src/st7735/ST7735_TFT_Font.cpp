@@ -1185,3 +1185,381 @@ const uint8_t (* pFontMia8x16ptr)[16] = Font_Eleven;
 #ifdef _TFT_OPTIONAL_FONT_12
 const uint8_t (* pFontDedica6x12ptr)[12] = Font_Twelve;
 #endif
+
+// Fonts 1-12 in font number order, a font not enabled keeps its size but has no data
+constexpr TFT_Font_t TFTFontTable[TFT_FONT_BUILTIN] = {
+	{Font_One, 5, 8, 0x00, 255, TFTFontLayout_Scalable},	// 1 default 5 by 8
+	{Font_Two, 7, 8, 0x20, 59, TFTFontLayout_Scalable},	// 2 thick 7 by 8 (NO LOWERCASE LETTERS)
+	{Font_Three, 4, 8, 0x20, 95, TFTFontLayout_Scalable},	// 3 seven segment 4 by 8
+	{Font_Four, 8, 8, 0x20, 59, TFTFontLayout_Scalable},	// 4 wide 8 by 8 (NO LOWERCASE LETTERS)
+	{Font_Five, 3, 8, 0x20, 95, TFTFontLayout_Scalable},	// 5 tiny 3 by 8
+	{Font_Six, 7, 8, 0x20, 95, TFTFontLayout_Scalable},	// 6 homespun 7 by 8
+	{Font_Seven[0], 16, 32, 0x2D, 14, TFTFontLayout_Column}, // 7 big nums 16 by 32 (NUMBERS + : only)
+	{Font_Eight[0], 16, 16, 0x2D, 14, TFTFontLayout_Column}, // 8 med nums 16 by 16 (NUMBERS + : only)
+#ifdef _TFT_OPTIONAL_FONT_9
+	{Font_Nine[0], 16, 24, 0x20, 95, TFTFontLayout_Column}, // 9 Arial round 16 by 24
+#else
+	{nullptr, 16, 24, 0x20, 95, TFTFontLayout_Column},
+#endif
+#ifdef _TFT_OPTIONAL_FONT_10
+	{Font_Ten[0], 16, 16, 0x20, 95, TFTFontLayout_Column}, // 10 Arial bold 16 by 16
+#else
+	{nullptr, 16, 16, 0x20, 95, TFTFontLayout_Column},
+#endif
+#ifdef _TFT_OPTIONAL_FONT_11
+	{Font_Eleven[0], 8, 16, 0x20, 95, TFTFontLayout_Column}, // 11 mia 8 by 16
+#else
+	{nullptr, 8, 16, 0x20, 95, TFTFontLayout_Column},
+#endif
+#ifdef _TFT_OPTIONAL_FONT_12
+	{Font_Twelve[0], 6, 12, 0x20, 95, TFTFontLayout_Column}, // 12 dedica 6 by 12
+#else
+	{nullptr, 6, 12, 0x20, 95, TFTFontLayout_Column},
+#endif
+};
+
+// Proportional font 1, 0x20-0x7E, each glyph cropped to its set pixels, 1 column spacing.
+// Accented Latin, Greek and math symbols from font 1's CP437 upper half follow, by Unicode code point.
+static const uint8_t FontProp_One_Bitmap[] = {
+	0xFA, 0xB6, 0x80, 0x52, 0xBE, 0xAF, 0xA9, 0x40, 0x23, 0xE8, 0xE2, 0xF8, 0x80, 0xC6, 0x44, 0x44,
+	0x4C, 0x60, 0x45, 0x28, 0x8A, 0xC9, 0xA0, 0x6D, 0x40, 0x2A, 0x48, 0x88, 0x88, 0x92, 0xA0, 0x25,
+	0x5D, 0xF7, 0x54, 0x80, 0x21, 0x3E, 0x42, 0x00, 0x6D, 0x40, 0xF8, 0xF0, 0x08, 0x88, 0x88, 0x00,
+	0x74, 0x67, 0x5C, 0xC5, 0xC0, 0x59, 0x24, 0xB8, 0x74, 0x42, 0xE8, 0x43, 0xE0, 0xF8, 0x44, 0x60,
+	0xC5, 0xC0, 0x11, 0x95, 0x2F, 0x88, 0x40, 0xFC, 0x3C, 0x10, 0xC5, 0xC0, 0x3A, 0x21, 0xE8, 0xC5,
+	0xC0, 0xF8, 0x42, 0x22, 0x22, 0x00, 0x74, 0x62, 0xE8, 0xC5, 0xC0, 0x74, 0x62, 0xF0, 0x8B, 0x80,
+	0xA0, 0x45, 0x80, 0x12, 0x48, 0x42, 0x10, 0xF8, 0x3E, 0x84, 0x21, 0x24, 0x80, 0x74, 0x42, 0x62,
+	0x00, 0x80, 0x74, 0x6B, 0x7B, 0x41, 0xE0, 0x22, 0xA3, 0x1F, 0xC6, 0x20, 0xF4, 0x63, 0xE8, 0xC7,
+	0xC0, 0x74, 0x61, 0x08, 0x45, 0xC0, 0xF4, 0x63, 0x18, 0xC7, 0xC0, 0xFC, 0x21, 0xE8, 0x43, 0xE0,
+	0xFC, 0x21, 0xE8, 0x42, 0x00, 0x7C, 0x61, 0x09, 0xC5, 0xE0, 0x8C, 0x63, 0xF8, 0xC6, 0x20, 0xE9,
+	0x24, 0xB8, 0x38, 0x84, 0x21, 0x49, 0x80, 0x8C, 0xA9, 0x8A, 0x4A, 0x20, 0x84, 0x21, 0x08, 0x43,
+	0xE0, 0x8E, 0xEB, 0x5A, 0xC6, 0x20, 0x8C, 0x73, 0x59, 0xC6, 0x20, 0x74, 0x63, 0x18, 0xC5, 0xC0,
+	0xF4, 0x63, 0xE8, 0x42, 0x00, 0x74, 0x63, 0x1A, 0xC9, 0xA0, 0xF4, 0x63, 0xEA, 0x4A, 0x20, 0x74,
+	0x60, 0xE0, 0xC5, 0xC0, 0xFD, 0x48, 0x42, 0x10, 0x80, 0x8C, 0x63, 0x18, 0xC5, 0xC0, 0x8C, 0x63,
+	0x18, 0xA8, 0x80, 0x8C, 0x63, 0x5A, 0xD5, 0x40, 0x8C, 0x54, 0x45, 0x46, 0x20, 0x8C, 0x54, 0x42,
+	0x10, 0x80, 0xF8, 0x44, 0xE4, 0x43, 0xE0, 0xF8, 0x88, 0x88, 0xF0, 0x82, 0x08, 0x20, 0x80, 0xF1,
+	0x11, 0x11, 0xF0, 0x22, 0xA2, 0xF8, 0xD9, 0x10, 0x60, 0x9D, 0x27, 0x80, 0x84, 0x2D, 0x98, 0xE6,
+	0xC0, 0x74, 0x61, 0x17, 0x00, 0x08, 0x5B, 0x38, 0xCD, 0xA0, 0x74, 0x7F, 0x07, 0x00, 0x25, 0x4E,
+	0x44, 0x40, 0x74, 0xE6, 0xD0, 0xB8, 0x84, 0x2D, 0x98, 0xC6, 0x20, 0x43, 0x24, 0xB8, 0x10, 0x11,
+	0x19, 0x60, 0x88, 0x9A, 0xCA, 0x90, 0xC9, 0x24, 0xB8, 0xD5, 0x6B, 0x5A, 0x80, 0xB6, 0x63, 0x18,
+	0x80, 0x74, 0x63, 0x17, 0x00, 0xB6, 0x73, 0x68, 0x40, 0x6C, 0xE6, 0xD0, 0x84, 0xB6, 0x61, 0x08,
+	0x00, 0x7C, 0x1C, 0x1F, 0x00, 0x21, 0x3E, 0x42, 0x14, 0x40, 0x8C, 0x63, 0x36, 0x80, 0x8C, 0x62,
+	0xA2, 0x00, 0x8C, 0x6B, 0x55, 0x00, 0x8A, 0x88, 0xA8, 0x80, 0x8C, 0x5E, 0x18, 0xB8, 0xF8, 0x88,
+	0x8F, 0x80, 0x29, 0x44, 0x88, 0xEE, 0x89, 0x14, 0xA0, 0x45, 0x44, 0xDE, 0x21, 0x3F, 0x4A, 0x7C,
+	0x84, 0x32, 0xD3, 0xC4, 0x27, 0xE0, 0xDE, 0xDD, 0xF2, 0x7C, 0x84, 0x74, 0xA4, 0xF0, 0x7C, 0x2A,
+	0xA8, 0xA2, 0x80, 0xF8, 0x42, 0x76, 0xF6, 0xE0, 0x21, 0x3E, 0x42, 0x03, 0xE0, 0xE3, 0x6C, 0xF0,
+	0x52, 0x94, 0xA6, 0xE0, 0xC0, 0x74, 0x62, 0xE0, 0x7C, 0xA2, 0x8A, 0xAA, 0x00, 0x84, 0x65, 0x55,
+	0xDC, 0x21, 0x84, 0x65, 0x74, 0xCC, 0x87, 0x20, 0x08, 0xC8, 0x45, 0xC0, 0xAA, 0xA3, 0x1F, 0xC6,
+	0x20, 0x20, 0x08, 0xA8, 0xFE, 0x31, 0x3A, 0xA5, 0xF9, 0x4A, 0x60, 0x74, 0x61, 0x08, 0xB8, 0x4C,
+	0x30, 0xF8, 0xE8, 0xF0, 0xF8, 0x33, 0xDB, 0xCE, 0x20, 0x8B, 0xA3, 0x18, 0xC5, 0xC0, 0x88, 0x23,
+	0x18, 0xC5, 0xC0, 0x74, 0x7D, 0x18, 0xFA, 0x00, 0xC0, 0x18, 0x27, 0x49, 0xE0, 0x18, 0x18, 0x27,
+	0x49, 0xE0, 0xF8, 0x18, 0x27, 0x49, 0xE0, 0x8B, 0x04, 0xE9, 0x3C, 0x30, 0x18, 0x27, 0x49, 0xE0,
+	0x78, 0x9F, 0x27, 0x80, 0x7E, 0x30, 0xF1, 0x18, 0xC0, 0x1D, 0x1F, 0xC1, 0xE0, 0x18, 0x1D, 0x1F,
+	0xC1, 0xE0, 0xF8, 0x1D, 0x1F, 0xC1, 0xE0, 0x88, 0x1D, 0x1F, 0xC1, 0xE0, 0xC0, 0x62, 0x22, 0x70,
+	0x63, 0x24, 0xB8, 0x69, 0x62, 0x22, 0x70, 0xA3, 0x24, 0xB8, 0xF0, 0xE9, 0x99, 0xC0, 0x1D, 0x18,
+	0xB8, 0x18, 0x1D, 0x18, 0xB8, 0x74, 0x40, 0xE8, 0xC5, 0xC0, 0x8B, 0xA3, 0x18, 0xB8, 0x31, 0x81,
+	0xF0, 0x18, 0xC0, 0xC0, 0x23, 0x19, 0xB4, 0x18, 0x23, 0x19, 0xB4, 0x74, 0x41, 0x18, 0xCD, 0xA0,
+	0x88, 0x23, 0x19, 0xB4, 0x90, 0x99, 0x97, 0x1E, 0xFC, 0xE1, 0x08, 0x40, 0x22, 0xA3, 0xF8, 0xA8,
+	0x80, 0xFC, 0x50, 0x44, 0x47, 0xE0, 0xF9, 0x1D, 0x18, 0xB8, 0x9F, 0x22, 0xA3, 0x15, 0x2B, 0x60,
+	0x6C, 0xA5, 0x26, 0x80, 0x32, 0x0C, 0xE8, 0xC5, 0xC0, 0x78, 0x8F, 0x88, 0x70, 0xFA, 0x94, 0xA5,
+	0x28, 0x7C, 0xA5, 0x26, 0x00, 0xFD, 0x08, 0x42, 0x10, 0x0B, 0xA7, 0x5A, 0xE5, 0xD0, 0x39, 0x08,
+	0x4A, 0x51, 0x84, 0x75, 0x6A, 0xE0, 0x11, 0x10, 0x41, 0x03, 0xE0, 0x41, 0x04, 0x44, 0x03, 0xE0,
+};
+
+static const TFT_Glyph_t FontProp_One_Glyphs[] = {
+	{0, 0, 0, 3, 0, 0}, // space
+	{0, 1, 7, 2, 0, 0}, // !
+	{1, 3, 3, 4, 0, 0}, // "
+	{3, 5, 7, 6, 0, 0}, // #
+	{8, 5, 7, 6, 0, 0}, // $
+	{13, 5, 7, 6, 0, 0}, // %
+	{18, 5, 7, 6, 0, 0}, // &
+	{23, 3, 4, 4, 0, 0}, // '
+	{25, 3, 7, 4, 0, 0}, // (
+	{28, 3, 7, 4, 0, 0}, // )
+	{31, 5, 7, 6, 0, 0}, // *
+	{36, 5, 5, 6, 0, 1}, // +
+	{40, 3, 4, 4, 0, 4}, // ,
+	{42, 5, 1, 6, 0, 3}, // -
+	{43, 2, 2, 3, 0, 5}, // .
+	{44, 5, 5, 6, 0, 1}, // /
+	{48, 5, 7, 6, 0, 0}, // 0
+	{53, 3, 7, 4, 0, 0}, // 1
+	{56, 5, 7, 6, 0, 0}, // 2
+	{61, 5, 7, 6, 0, 0}, // 3
+	{66, 5, 7, 6, 0, 0}, // 4
+	{71, 5, 7, 6, 0, 0}, // 5
+	{76, 5, 7, 6, 0, 0}, // 6
+	{81, 5, 7, 6, 0, 0}, // 7
+	{86, 5, 7, 6, 0, 0}, // 8
+	{91, 5, 7, 6, 0, 0}, // 9
+	{96, 1, 3, 2, 0, 2}, // :
+	{97, 2, 5, 3, 0, 2}, // ;
+	{99, 4, 7, 5, 0, 0}, // <
+	{103, 5, 3, 6, 0, 2}, // =
+	{105, 4, 7, 5, 0, 0}, // >
+	{109, 5, 7, 6, 0, 0}, // ?
+	{114, 5, 7, 6, 0, 0}, // @
+	{119, 5, 7, 6, 0, 0}, // A
+	{124, 5, 7, 6, 0, 0}, // B
+	{129, 5, 7, 6, 0, 0}, // C
+	{134, 5, 7, 6, 0, 0}, // D
+	{139, 5, 7, 6, 0, 0}, // E
+	{144, 5, 7, 6, 0, 0}, // F
+	{149, 5, 7, 6, 0, 0}, // G
+	{154, 5, 7, 6, 0, 0}, // H
+	{159, 3, 7, 4, 0, 0}, // I
+	{162, 5, 7, 6, 0, 0}, // J
+	{167, 5, 7, 6, 0, 0}, // K
+	{172, 5, 7, 6, 0, 0}, // L
+	{177, 5, 7, 6, 0, 0}, // M
+	{182, 5, 7, 6, 0, 0}, // N
+	{187, 5, 7, 6, 0, 0}, // O
+	{192, 5, 7, 6, 0, 0}, // P
+	{197, 5, 7, 6, 0, 0}, // Q
+	{202, 5, 7, 6, 0, 0}, // R
+	{207, 5, 7, 6, 0, 0}, // S
+	{212, 5, 7, 6, 0, 0}, // T
+	{217, 5, 7, 6, 0, 0}, // U
+	{222, 5, 7, 6, 0, 0}, // V
+	{227, 5, 7, 6, 0, 0}, // W
+	{232, 5, 7, 6, 0, 0}, // X
+	{237, 5, 7, 6, 0, 0}, // Y
+	{242, 5, 7, 6, 0, 0}, // Z
+	{247, 4, 7, 5, 0, 0}, // [
+	{251, 5, 5, 6, 0, 1}, // backslash
+	{255, 4, 7, 5, 0, 0}, // ]
+	{259, 5, 3, 6, 0, 0}, // ^
+	{261, 5, 1, 6, 0, 6}, // _
+	{262, 3, 4, 4, 0, 0}, // `
+	{264, 5, 5, 6, 0, 2}, // a
+	{268, 5, 7, 6, 0, 0}, // b
+	{273, 5, 5, 6, 0, 2}, // c
+	{277, 5, 7, 6, 0, 0}, // d
+	{282, 5, 5, 6, 0, 2}, // e
+	{286, 4, 7, 5, 0, 0}, // f
+	{290, 5, 6, 6, 0, 2}, // g
+	{294, 5, 7, 6, 0, 0}, // h
+	{299, 3, 7, 4, 0, 0}, // i
+	{302, 4, 7, 5, 0, 0}, // j
+	{306, 4, 7, 5, 0, 0}, // k
+	{310, 3, 7, 4, 0, 0}, // l
+	{313, 5, 5, 6, 0, 2}, // m
+	{317, 5, 5, 6, 0, 2}, // n
+	{321, 5, 5, 6, 0, 2}, // o
+	{325, 5, 6, 6, 0, 2}, // p
+	{329, 5, 6, 6, 0, 2}, // q
+	{333, 5, 5, 6, 0, 2}, // r
+	{337, 5, 5, 6, 0, 2}, // s
+	{341, 5, 7, 6, 0, 0}, // t
+	{346, 5, 5, 6, 0, 2}, // u
+	{350, 5, 5, 6, 0, 2}, // v
+	{354, 5, 5, 6, 0, 2}, // w
+	{358, 5, 5, 6, 0, 2}, // x
+	{362, 5, 6, 6, 0, 2}, // y
+	{366, 5, 5, 6, 0, 2}, // z
+	{370, 3, 7, 4, 0, 0}, // {
+	{373, 1, 7, 2, 0, 0}, // |
+	{374, 3, 7, 4, 0, 0}, // }
+	{377, 5, 3, 6, 0, 0}, // ~
+	{379, 1, 7, 2, 0, 0}, // U+00A1 ¡
+	{380, 5, 8, 6, 0, 0}, // U+00A2 ¢
+	{385, 5, 7, 6, 0, 0}, // U+00A3 £
+	{390, 5, 8, 6, 0, 0}, // U+00A5 ¥
+	{395, 5, 6, 6, 0, 0}, // U+00AA ª
+	{399, 5, 5, 6, 0, 1}, // U+00AB «
+	{403, 5, 3, 6, 0, 3}, // U+00AC ¬
+	{405, 5, 4, 6, 0, 0}, // U+00B0 °
+	{408, 5, 7, 6, 0, 0}, // U+00B1 ±
+	{413, 4, 5, 5, 0, 0}, // U+00B2 ²
+	{416, 5, 6, 6, 0, 1}, // U+00B5 µ
+	{420, 2, 1, 3, 0, 4}, // U+00B7 ·
+	{421, 5, 6, 6, 0, 0}, // U+00BA º
+	{425, 5, 5, 6, 0, 1}, // U+00BB »
+	{429, 5, 8, 6, 0, 0}, // U+00BC ¼
+	{434, 5, 8, 6, 0, 0}, // U+00BD ½
+	{439, 5, 7, 6, 0, 0}, // U+00BF ¿
+	{444, 5, 7, 6, 0, 0}, // U+00C4 Ä
+	{449, 5, 8, 6, 0, 0}, // U+00C5 Å
+	{454, 5, 7, 6, 0, 0}, // U+00C6 Æ
+	{459, 5, 8, 6, 0, 0}, // U+00C7 Ç
+	{464, 4, 7, 5, 0, 0}, // U+00C9 É
+	{468, 5, 7, 6, 0, 0}, // U+00D1 Ñ
+	{473, 5, 7, 6, 0, 0}, // U+00D6 Ö
+	{478, 5, 7, 6, 0, 0}, // U+00DC Ü
+	{483, 5, 7, 6, 0, 1}, // U+00DF ß
+	{488, 5, 7, 6, 0, 0}, // U+00E0 à
+	{493, 5, 7, 6, 0, 0}, // U+00E1 á
+	{498, 5, 7, 6, 0, 0}, // U+00E2 â
+	{503, 5, 6, 6, 0, 1}, // U+00E4 ä
+	{507, 5, 7, 6, 0, 0}, // U+00E5 å
+	{512, 5, 5, 6, 0, 2}, // U+00E6 æ
+	{516, 5, 6, 6, 0, 1}, // U+00E7 ç
+	{520, 5, 7, 6, 0, 0}, // U+00E8 è
+	{525, 5, 7, 6, 0, 0}, // U+00E9 é
+	{530, 5, 7, 6, 0, 0}, // U+00EA ê
+	{535, 5, 7, 6, 0, 0}, // U+00EB ë
+	{540, 4, 7, 5, 0, 0}, // U+00EC ì
+	{544, 3, 7, 4, 0, 0}, // U+00ED í
+	{547, 4, 7, 5, 0, 0}, // U+00EE î
+	{551, 3, 7, 4, 0, 0}, // U+00EF ï
+	{554, 4, 6, 5, 0, 1}, // U+00F1 ñ
+	{557, 5, 6, 6, 0, 1}, // U+00F2 ò
+	{561, 5, 6, 6, 0, 1}, // U+00F3 ó
+	{565, 5, 7, 6, 0, 0}, // U+00F4 ô
+	{570, 5, 6, 6, 0, 1}, // U+00F6 ö
+	{574, 5, 7, 6, 0, 0}, // U+00F7 ÷
+	{579, 5, 6, 6, 0, 1}, // U+00F9 ù
+	{583, 5, 6, 6, 0, 1}, // U+00FA ú
+	{587, 5, 7, 6, 0, 0}, // U+00FB û
+	{592, 5, 6, 6, 0, 1}, // U+00FC ü
+	{596, 4, 8, 5, 0, 0}, // U+00FF ÿ
+	{600, 5, 6, 6, 0, 1}, // U+0393 Γ
+	{604, 5, 7, 6, 0, 0}, // U+0398 Θ
+	{609, 5, 7, 6, 0, 0}, // U+03A3 Σ
+	{614, 5, 8, 6, 0, 0}, // U+03A6 Φ
+	{619, 5, 7, 6, 0, 0}, // U+03A9 Ω
+	{624, 5, 5, 6, 0, 2}, // U+03B1 α
+	{628, 5, 7, 6, 0, 0}, // U+03B4 δ
+	{633, 4, 7, 5, 0, 0}, // U+03B5 ε
+	{637, 5, 6, 6, 0, 1}, // U+03C0 π
+	{641, 5, 5, 6, 0, 2}, // U+03C3 σ
+	{645, 5, 6, 6, 0, 1}, // U+03C4 τ
+	{649, 5, 8, 6, 0, 0}, // U+03C6 φ
+	{654, 5, 8, 6, 0, 0}, // U+221A √
+	{659, 5, 4, 6, 0, 3}, // U+221E ∞
+	{662, 5, 7, 6, 0, 0}, // U+2264 ≤
+	{667, 5, 7, 6, 0, 0}, // U+2265 ≥
+};
+
+static const TFT_Kern_t FontProp_One_Kerning[] = {
+	{'F', ',', -1}, {'F', '.', -1}, {'F', 'A', -1}, {'F', 'a', -1}, {'F', 'c', -1}, {'F', 'd', -1},
+	{'F', 'e', -1}, {'F', 'g', -1}, {'F', 'j', -1}, {'F', 'm', -1}, {'F', 'n', -1}, {'F', 'o', -1},
+	{'F', 'p', -1}, {'F', 'q', -1}, {'F', 'r', -1}, {'F', 's', -1}, {'F', 'u', -1}, {'F', 'v', -1},
+	{'F', 'w', -1}, {'F', 'x', -1}, {'F', 'y', -1}, {'F', 'z', -1}, {'L', 'T', -1}, {'L', 'V', -1},
+	{'L', 'Y', -1}, {'L', 'g', -1}, {'L', 'q', -1}, {'L', 'v', -1}, {'P', ',', -1}, {'P', '.', -1},
+	{'P', 'a', -1}, {'P', 'j', -1}, {'T', ',', -1}, {'T', '.', -1}, {'T', 'a', -1}, {'T', 'c', -1},
+	{'T', 'd', -1}, {'T', 'e', -1}, {'T', 'g', -1}, {'T', 'j', -1}, {'T', 'o', -1}, {'T', 'q', -1},
+	{'T', 's', -1}, {'V', ',', -1}, {'W', ',', -1}, {'Y', ',', -1}, {'Y', '.', -1}, {'Y', 'a', -1},
+	{'Y', 'c', -1}, {'Y', 'd', -1}, {'Y', 'e', -1}, {'Y', 'g', -1}, {'Y', 'j', -1}, {'Y', 'o', -1},
+	{'Y', 'q', -1}, {'Y', 's', -1}, {'f', ',', -1}, {'f', '.', -1}, {'f', 'a', -1}, {'f', 'c', -1},
+	{'f', 'd', -1}, {'f', 'e', -1}, {'f', 'g', -1}, {'f', 'j', -1}, {'f', 'o', -1}, {'f', 'q', -1},
+	{'f', 's', -1}, {'r', ',', -1}, {'r', '.', -1}, {'r', 'T', -1}, {'r', 'Y', -1}, {'r', 'a', -1},
+	{'r', 'j', -1}, {'v', ',', -1}, {'w', ',', -1},
+};
+
+static const uint16_t FontProp_One_Codes[] = {
+	0x00A1, 0x00A2, 0x00A3, 0x00A5, 0x00AA, 0x00AB, 0x00AC, 0x00B0,
+	0x00B1, 0x00B2, 0x00B5, 0x00B7, 0x00BA, 0x00BB, 0x00BC, 0x00BD,
+	0x00BF, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C9, 0x00D1, 0x00D6,
+	0x00DC, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E4, 0x00E5, 0x00E6,
+	0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE,
+	0x00EF, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F6, 0x00F7, 0x00F9,
+	0x00FA, 0x00FB, 0x00FC, 0x00FF, 0x0393, 0x0398, 0x03A3, 0x03A6,
+	0x03A9, 0x03B1, 0x03B4, 0x03B5, 0x03C0, 0x03C3, 0x03C4, 0x03C6,
+	0x221A, 0x221E, 0x2264, 0x2265,
+};
+
+constexpr TFT_PropFont_t TFTFontPropDefault = {
+	FontProp_One_Bitmap, FontProp_One_Glyphs, FontProp_One_Kerning,
+	sizeof(FontProp_One_Kerning) / sizeof(TFT_Kern_t), 0x20, 0x7E, 8, TFTGlyph_Bits,
+	FontProp_One_Codes, sizeof(FontProp_One_Codes) / sizeof(uint16_t)};
+
+// Proportional big numbers 0x2D-0x3A made from font 7, RLE glyph boxes, 458 bytes against 896
+static const uint8_t FontProp_BigNum_Bitmap[] = {
+	0x0F, 0x0F, 0x0F, 0x0F, 0x25, 0x37, 0x1F, 0x0F, 0x0F, 0x0F, 0x03, 0x17, 0x35, 0x20, 0xA3, 0xA5,
+	0x95, 0x95, 0x86, 0x84, 0x95, 0x95, 0x94, 0x95, 0x95, 0x85, 0x95, 0x86, 0x85, 0x86, 0x86, 0x85,
+	0x86, 0x85, 0x95, 0x85, 0x86, 0x85, 0x94, 0xA4, 0xB2, 0xB0, 0x0F, 0x0B, 0x84, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x8F, 0x0B, 0x08, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x0F, 0x0B, 0x84, 0x82, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x0D, 0xA2, 0xA2,
+	0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x09, 0x0F, 0x0B, 0x82, 0xA2, 0xA2, 0xA2,
+	0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x2A, 0x2A, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0xA4, 0x84, 0x8F, 0x0B, 0x02, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x8F, 0x0B, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0x0F, 0x0B, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x09, 0xA2,
+	0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA4, 0x84, 0x8F, 0x0B, 0x0F, 0x0B, 0x84, 0x84, 0xA2,
+	0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x0B, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x8F, 0x0B, 0x0F, 0x0B, 0x84, 0x82, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0x0F, 0x0B, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8F, 0x0D, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8F, 0x0B, 0x0F, 0x0B, 0x84, 0x84, 0x84,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8F, 0x0B, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0xA4, 0x84, 0x8F, 0x0B, 0x0E, 0x24, 0x24, 0x24, 0x24, 0x24, 0x22, 0xF0, 0xF0, 0xF0, 0x32,
+	0x24, 0x24, 0x24, 0x24, 0x24, 0x2E,
+};
+
+static const TFT_Glyph_t FontProp_BigNum_Glyphs[] = {
+	{0, 12, 5, 16, 2, 18}, // -
+	{4, 9, 11, 16, 3, 16}, // .
+	{14, 14, 27, 16, 1, 3}, // /
+	{42, 12, 28, 16, 2, 2}, // 0
+	{69, 4, 28, 16, 6, 2}, // 1
+	{96, 12, 28, 16, 2, 2}, // 2
+	{122, 12, 28, 16, 2, 2}, // 3
+	{149, 12, 28, 16, 2, 2}, // 4
+	{177, 12, 28, 16, 2, 2}, // 5
+	{203, 12, 28, 16, 2, 2}, // 6
+	{229, 12, 28, 16, 2, 2}, // 7
+	{257, 12, 28, 16, 2, 2}, // 8
+	{283, 12, 28, 16, 2, 2}, // 9
+	{309, 6, 24, 16, 5, 4}, // :
+};
+
+constexpr TFT_PropFont_t TFTFontPropBigNum = {
+	FontProp_BigNum_Bitmap, FontProp_BigNum_Glyphs, nullptr, 0, 0x2D, 0x3A, 32, TFTGlyph_RLE};
+
+// Proportional big numbers 0x2D-0x3A, font 7 shrunk to half size, 4 bit anti-aliased
+static const uint8_t FontProp_BigNumAA_Bitmap[] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x0B, 0xFF, 0x48, 0xFF, 0xFF, 0x8F, 0xFF,
+	0xF8, 0xFF, 0xFF, 0x4F, 0xFF, 0xB0, 0x48, 0x80, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x0F, 0xF8,
+	0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0x00,
+	0x00, 0x0F, 0xF8, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0x80, 0x00,
+	0x08, 0xFF, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+	0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+	0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+	0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x88, 0x88, 0x8F, 0xF8, 0x88, 0x88,
+	0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+	0x0F, 0x00, 0x00, 0x0F, 0x08, 0x88, 0x8F, 0x08, 0x88, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+	0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0,
+	0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x88,
+	0x8F, 0x88, 0x88, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+	0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+	0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x8F, 0x00, 0x00,
+	0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
+	0x00, 0x00, 0xF8, 0x88, 0x88, 0xF8, 0x88, 0x8F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+	0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
+	0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,
+	0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
+	0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+	0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x88, 0x8F, 0xF8, 0x88, 0x8F, 0xF0, 0x00, 0x0F, 0xF0,
+	0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+	0xF8, 0x88, 0x8F, 0x88, 0x88, 0x8F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00,
+	0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x8F, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0xF8,
+};
+
+static const TFT_Glyph_t FontProp_BigNumAA_Glyphs[] = {
+	{0, 6, 3, 8, 1, 9}, // -
+	{9, 5, 6, 8, 1, 8}, // .
+	{24, 8, 14, 8, 0, 1}, // /
+	{80, 6, 14, 8, 1, 1}, // 0
+	{122, 2, 14, 8, 3, 1}, // 1
+	{136, 6, 14, 8, 1, 1}, // 2
+	{178, 6, 14, 8, 1, 1}, // 3
+	{220, 6, 14, 8, 1, 1}, // 4
+	{262, 6, 14, 8, 1, 1}, // 5
+	{304, 6, 14, 8, 1, 1}, // 6
+	{346, 6, 14, 8, 1, 1}, // 7
+	{388, 6, 14, 8, 1, 1}, // 8
+	{430, 6, 14, 8, 1, 1}, // 9
+	{472, 4, 12, 8, 2, 2}, // :
+};
+
+constexpr TFT_PropFont_t TFTFontPropBigNumAA = {
+	FontProp_BigNumAA_Bitmap, FontProp_BigNumAA_Glyphs, nullptr, 0, 0x2D, 0x3A, 16, TFTGlyph_Gray4};
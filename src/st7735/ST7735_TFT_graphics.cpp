@@ -9,6 +9,24 @@
 #include "../../include/st7735/ST7735_TFT.hpp"
 #include "../../include/st7735/ST7735_TFT_Font.hpp"
 
+/*! User DMA completion callbacks indexed by DMA channel, serviced by DMAIrqHandler */
+static void (*DMACallbacks[NUM_DMA_CHANNELS])(void);
+
+/*!
+	@brief Shared DMA_IRQ_0 handler, acknowledges our channels and calls the user callbacks
+*/
+static void DMAIrqHandler(void)
+{
+	for (uint ch = 0; ch < NUM_DMA_CHANNELS; ch++)
+	{
+		if (DMACallbacks[ch] != nullptr && dma_channel_get_irq0_status(ch))
+		{
+			dma_channel_acknowledge_irq0(ch);
+			DMACallbacks[ch]();
+		}
+	}
+}
+
 /*!
 	@brief Construct a new st7735 tft graphics::st7735 tft graphics object
  */
@@ -26,11 +44,26 @@ void ST7735_TFT_graphics ::TFTdrawPixel(uint8_t x, uint8_t y, uint16_t color)
 {
 	if ((x >= _widthTFT) || (y >= _heightTFT))
 		return;
-	TFTsetAddrWindow(x, y, x + 1, y + 1);
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, (int16_t)color};
+		displayListRecord(TFTOp_Pixel, args, 3, nullptr, x, y, x, y, true);
+		return;
+	}
+	if (_ramTarget.buffer != nullptr)
+	{
+		const RamTarget_t &target = _ramTarget;
+		if (x < target.x || y < target.y || x >= target.x + target.w || y >= target.y + target.h)
+			return;
+		ramTargetWaitIdle();
+		ramTargetPut((uint32_t)(y - target.y) * target.w + (x - target.x), color);
+		if (_ramMode == TFTRAM_FrameBuffer)
+			frameBufferMarkDirty(x, y, x, y);
+		return;
+	}
+	TFTsetAddrWindow(x, y, x, y);
 	uint8_t TransmitBuffer[2] {(uint8_t)(color >> 8), (uint8_t)(color & 0xFF)};
 	spiWriteDataBuffer(TransmitBuffer, 2);
-	//writeData(color >> 8);
-	//writeData(color & 0xFF);
 }
 
 /*!
@@ -40,20 +73,70 @@ void ST7735_TFT_graphics ::TFTdrawPixel(uint8_t x, uint8_t y, uint16_t color)
   @param  x1  Width of window
   @param  y1  Height of window
   @note https://en.wikipedia.org/wiki/Bit_blit
+	CS is held low for the whole sequence and the CASET/RASET parameters
+	are sent as one 4 byte burst each, DC only toggles at command/data boundaries.
+	The last programmed window is cached, only changed parameters are resent.
+	The row range is programmed down to the bottom of the screen, callers write
+	exactly (x1-x0+1)*(y1-y0+1) pixels so this does not change what is drawn,
+	but it means a window that starts where the last write ended (e.g. the next
+	row of a bitmap, next pixel down a glyph column) needs no commands at all.
+	When drawing to RAM (framebuffer or tile) the window is only recorded, nothing is sent.
  */
 void ST7735_TFT_graphics ::TFTsetAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 {
-	writeCommand(ST7735_CASET);
-	writeData(0);
-	writeData(x0 + _XStart);
-	writeData(0);
-	writeData(x1 + _XStart);
-	writeCommand(ST7735_RASET);
-	writeData(0);
-	writeData(y0 + _YStart);
-	writeData(0);
-	writeData(y1 + _YStart);
-	writeCommand(ST7735_RAMWR); // Write to RAM
+	if (_ramTarget.buffer != nullptr)
+	{
+		const RamTarget_t &target = _ramTarget;
+		if (x1 >= _widthTFT)
+			x1 = _widthTFT - 1;
+		if (y1 >= _heightTFT)
+			y1 = _heightTFT - 1;
+		bool valid = x0 <= x1 && y0 <= y1 && x1 >= target.x && x0 < target.x + target.w &&
+					 y1 >= target.y && y0 < target.y + target.h;
+		_fbWindow = {valid, x0, y0, x1, y1, x0, y0};
+		if (valid && _ramMode == TFTRAM_FrameBuffer)
+			frameBufferMarkDirty(x0, y0, x1, y1);
+		return;
+	}
+	uint8_t colStart = x0 + _XStart;
+	uint8_t colEnd = x1 + _XStart;
+	uint8_t rowStart = y0 + _YStart;
+	uint8_t rowEnd = y1 + _YStart;
+	uint8_t rowBottom = _heightTFT - 1 + _YStart;
+	if (rowEnd < rowBottom)
+		rowEnd = rowBottom;
+
+	// 1. Sequential write, RAM pointer already sits at the start of this window
+	if (_addrWindow.ramWriteActive && _addrWindow.colStart == colStart && _addrWindow.colEnd == colEnd &&
+		(y1 + _YStart) <= _addrWindow.rowEnd)
+	{
+		uint32_t width = colEnd - colStart + 1;
+		if ((_addrWindow.pixelsWritten % width) == 0 &&
+			_addrWindow.rowStart + (_addrWindow.pixelsWritten / width) == rowStart)
+			return;
+	}
+	// 2. Send only the parameters that changed, RAMWR always needed to reset the RAM pointer
+	uint8_t columns[4] {0, colStart, 0, colEnd};
+	uint8_t rows[4] {0, rowStart, 0, rowEnd};
+	TFTwaitIdle();
+	TFT_CS_SetLow;
+	if (!_addrWindow.valid || _addrWindow.colStart != colStart || _addrWindow.colEnd != colEnd)
+		spiWriteCommandBytes(ST7735_CASET, columns, sizeof(columns));
+	if (!_addrWindow.valid || _addrWindow.rowStart != rowStart || _addrWindow.rowEnd != rowEnd)
+		spiWriteCommandBytes(ST7735_RASET, rows, sizeof(rows));
+	spiWriteCommandBytes(ST7735_RAMWR, nullptr, 0); // Write to RAM
+	TFT_CS_SetHigh;
+	_addrWindow = {true, true, colStart, colEnd, rowStart, rowEnd, 0};
+}
+
+/*!
+	@brief Forget the cached address window, next TFTsetAddrWindow sends CASET RASET and RAMWR.
+	@note Called by writeCommand, so any other command (init, rotation, scroll) invalidates it.
+*/
+void ST7735_TFT_graphics::addrWindowInvalidate(void)
+{
+	_addrWindow.valid = false;
+	_addrWindow.ramWriteActive = false;
 }
 
 /*!
@@ -66,7 +149,7 @@ void ST7735_TFT_graphics ::TFTsetAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1,
 	@return
 		-# Display_Success for success
 		-# Display_ShapeScreenBounds out of screen bounds
-	@note  uses spiWriteBuffer method
+	@note  one address window for the whole rectangle, see fillRectSolid
 */
 Display_Return_Codes_e  ST7735_TFT_graphics::TFTfillRectBuffer(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color)
 {
@@ -76,32 +159,48 @@ Display_Return_Codes_e  ST7735_TFT_graphics::TFTfillRectBuffer(uint8_t x, uint8_
 		printf("Error TFTfillRectangle 2: Out of screen bounds\r\n");
 		return Display_ShapeScreenBounds;
 	}
+	fillRectSolid(x, y, w, h, color);
+	return Display_Success;
+}
+
+/*!
+	@brief Solid fill of a rectangle clipped to the screen, one address window and one transfer
+	@param x x coordinate
+	@param y y coordinate
+	@param w width of the rectangle
+	@param h height of the rectangle
+	@param color color to fill rectangle 565 16-bit
+	@note the w*h pixels are streamed from a single color word, see spiWriteColorRepeatAsync
+*/
+void ST7735_TFT_graphics::fillRectSolid(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color)
+{
+	if ((x >= _widthTFT) || (y >= _heightTFT) || w == 0 || h == 0)
+		return;
 	if ((x + w - 1) >= _widthTFT)
 		w = _widthTFT - x;
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
-
-	// Convert color to bytes
-	uint8_t hi = color >> 8;
-	uint8_t lo = color;
-
-	// Row buffer for one row of the rectangle
-	uint8_t rowBuffer[w * 2]; // Each pixel is 2 bytes (16-bit color)
-	// Fill the row buffer with the color
-	for (uint32_t i = 0; i < w; i++)
+	if (displayListActive())
 	{
-		rowBuffer[2 * i] = hi;
-		rowBuffer[2 * i + 1] = lo;
+		int16_t args[] = {x, y, w, h, (int16_t)color};
+		displayListRecord(TFTOp_FillRect, args, 5, nullptr, x, y, x + w - 1, y + h - 1, true);
+		return;
 	}
-	// Draw the rectangle row by row
-	for (uint8_t j = 0; j < h; j++)
+	// Drawing to RAM only the part inside the target can change, e.g. one tile
+	if (_ramTarget.buffer != nullptr)
 	{
-		// Set the address window for the current row
-		TFTsetAddrWindow(x, y + j, x + w - 1, y + j);
-		// Write the row buffer to the display
-		spiWriteDataBuffer(rowBuffer, w * 2);
+		const RamTarget_t &target = _ramTarget;
+		uint8_t x1 = (x + w < target.x + target.w) ? x + w : target.x + target.w;
+		uint8_t y1 = (y + h < target.y + target.h) ? y + h : target.y + target.h;
+		x = (x > target.x) ? x : target.x;
+		y = (y > target.y) ? y : target.y;
+		if (x >= x1 || y >= y1)
+			return;
+		w = x1 - x;
+		h = y1 - y;
 	}
-	return Display_Success;
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	spiWriteColorRepeatAsync(color, (uint32_t)w * h);
 }
 
 
@@ -123,23 +222,7 @@ void ST7735_TFT_graphics ::TFTfillScreen(uint16_t color)
 */
 void ST7735_TFT_graphics ::TFTdrawFastVLine(uint8_t x, uint8_t y, uint8_t h, uint16_t color)
 {
-	uint8_t hi, lo;
-	if ((x >= _widthTFT) || (y >= _heightTFT))
-		return;
-	if ((y + h - 1) >= _heightTFT)
-		h = _heightTFT - y;
-	hi = color >> 8;
-	lo = color;
-	TFTsetAddrWindow(x, y, x, y + h - 1);
-	TFT_DC_SetHigh;
-
-	TFT_CS_SetLow;
-	while (h--)
-	{
-		spiWrite(hi);
-		spiWrite(lo);
-	}
-	TFT_CS_SetHigh;
+	fillRectSolid(x, y, 1, h, color);
 }
 
 /*!
@@ -151,22 +234,7 @@ void ST7735_TFT_graphics ::TFTdrawFastVLine(uint8_t x, uint8_t y, uint8_t h, uin
 */
 void ST7735_TFT_graphics ::TFTdrawFastHLine(uint8_t x, uint8_t y, uint8_t w, uint16_t color)
 {
-	uint8_t hi, lo;
-	if ((x >= _widthTFT) || (y >= _heightTFT))
-		return;
-	if ((x + w - 1) >= _widthTFT)
-		w = _widthTFT - x;
-	hi = color >> 8;
-	lo = color;
-	TFTsetAddrWindow(x, y, x + w - 1, y);
-	TFT_DC_SetHigh;
-	TFT_CS_SetLow;
-	while (w--)
-	{
-		spiWrite(hi);
-		spiWrite(lo);
-	}
-	TFT_CS_SetHigh;
+	fillRectSolid(x, y, w, 1, color);
 }
 
 /*!
@@ -178,45 +246,185 @@ void ST7735_TFT_graphics ::TFTdrawFastHLine(uint8_t x, uint8_t y, uint8_t w, uin
 */
 void ST7735_TFT_graphics ::TFTdrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 {
-	int16_t f, ddF_x, ddF_y, x, y;
-	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
-	TFTdrawPixel(x0, y0 + r, color);
-	TFTdrawPixel(x0, y0 - r, color);
-	TFTdrawPixel(x0 + r, y0, color);
-	TFTdrawPixel(x0 - r, y0, color);
-	while (x < y)
+	if (displayListActive())
 	{
-		if (f >= 0)
-		{
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
-		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
-		TFTdrawPixel(x0 + x, y0 + y, color);
-		TFTdrawPixel(x0 - x, y0 + y, color);
-		TFTdrawPixel(x0 + x, y0 - y, color);
-		TFTdrawPixel(x0 - x, y0 - y, color);
-		TFTdrawPixel(x0 + y, y0 + x, color);
-		TFTdrawPixel(x0 - y, y0 + x, color);
-		TFTdrawPixel(x0 + y, y0 - x, color);
-		TFTdrawPixel(x0 - y, y0 - x, color);
+		int16_t args[] = {x0, y0, r, (int16_t)color};
+		displayListRecord(TFTOp_Circle, args, 4, nullptr, x0 - r, y0 - r, x0 + r, y0 + r, false);
+		return;
 	}
+	circleRuns(x0, y0, r, 0x0F, true, color, nullptr);
 }
 
 /*!
 	@brief Used internally by TFTdrawRoundRect
 */
 void ST7735_TFT_graphics ::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color)
+{
+	circleRuns(x0, y0, r, cornername, false, color, nullptr);
+}
+
+/*!
+	@brief Used internally by TFTfillRoundRect, fills the rectangle and its corners one span per row
+	@param x0 center x of the left corners
+	@param y0 center y of the top corners
+	@param r radius of the corners
+	@param width straight middle of each span, left corner centers to right ones
+	@param delta straight middle rows, top corner centers to bottom ones
+	@param color 565 16-bit
+	@note The top corners come from the upper half of a circle at y0, the bottom corners
+		from the lower half of one at y0 + delta, the rows between are r wide.
+*/
+void ST7735_TFT_graphics ::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, int16_t width, int16_t delta, uint16_t color)
+{
+	int16_t halfWidth[TFT_MAX_ROW_PIXELS];
+	int16_t lower[TFT_MAX_ROW_PIXELS];
+	circleRuns(x0, y0, r, 0x0F, true, color, spanTableClear(halfWidth));
+	circleRuns(x0, y0 + delta, r, 0x0F, true, color, spanTableClear(lower));
+	for (int16_t row = (y0 < 0) ? 0 : y0; row < _heightTFT; row++)
+		halfWidth[row] = (row > y0 + delta) ? lower[row] : r;
+	fillSpans(x0, halfWidth, nullptr, color, width);
+}
+
+/*!
+	@brief fills a circle where (x0,y0) are center coordinates an r is circle radius.
+	@param x0 circle center x position
+	@param y0 circle center y position
+	@param r radius of circle
+	@param color color of the circle , 565 16 Bit color
+*/
+void ST7735_TFT_graphics ::TFTfillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, r, (int16_t)color};
+		displayListRecord(TFTOp_FillCircle, args, 4, nullptr, x0 - r, y0 - r, x0 + r, y0 + r, false);
+		return;
+	}
+	int16_t halfWidth[TFT_MAX_ROW_PIXELS];
+	circleRuns(x0, y0, r, 0x0F, true, color, spanTableClear(halfWidth));
+	fillSpans(x0, halfWidth, nullptr, color);
+}
+
+/*!
+	@brief draws an ellipse where (x0,y0) are center coordinates
+	@param x0 center x position
+	@param y0 center y position
+	@param rx horizontal radius
+	@param ry vertical radius
+	@param color color of the ellipse , 565 16 Bit color
+	@note Same pixels as TFTdrawCircle when rx equals ry.
+*/
+void ST7735_TFT_graphics ::TFTdrawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, rx, ry, (int16_t)color};
+		displayListRecord(TFTOp_Ellipse, args, 5, nullptr, x0 - rx, y0 - ry, x0 + rx, y0 + ry, false);
+		return;
+	}
+	ellipseRuns(x0, y0, rx, ry, color, nullptr);
+}
+
+/*!
+	@brief fills an ellipse where (x0,y0) are center coordinates
+	@param x0 center x position
+	@param y0 center y position
+	@param rx horizontal radius
+	@param ry vertical radius
+	@param color color of the ellipse , 565 16 Bit color
+*/
+void ST7735_TFT_graphics ::TFTfillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, rx, ry, (int16_t)color};
+		displayListRecord(TFTOp_FillEllipse, args, 5, nullptr, x0 - rx, y0 - ry, x0 + rx, y0 + ry, false);
+		return;
+	}
+	int16_t halfWidth[TFT_MAX_ROW_PIXELS];
+	ellipseRuns(x0, y0, rx, ry, color, spanTableClear(halfWidth));
+	fillSpans(x0, halfWidth, nullptr, color);
+}
+
+/*!
+	@brief draws an arc of a circle, clockwise from startAngle to endAngle
+	@param x0 circle center x position
+	@param y0 circle center y position
+	@param r radius
+	@param startAngle degrees, 0 = 12 o'clock, 90 = 3 o'clock
+	@param endAngle degrees, an end before the start wraps past 12 o'clock, equal = full circle
+	@param color color of the arc , 565 16 Bit color
+	@note The pixels are those of TFTdrawCircle that lie in the sector.
+*/
+void ST7735_TFT_graphics ::TFTdrawArc(int16_t x0, int16_t y0, int16_t r, int16_t startAngle, int16_t endAngle, uint16_t color)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, r, startAngle, endAngle, (int16_t)color};
+		displayListRecord(TFTOp_Arc, args, 6, nullptr, x0 - r, y0 - r, x0 + r, y0 + r, false);
+		return;
+	}
+	arcFilterSet(x0, y0, startAngle, endAngle);
+	circleRuns(x0, y0, r, 0x0F, true, color, nullptr);
+	_arcFilter.active = false;
+}
+
+/*!
+	@brief fills a ring segment, clockwise from startAngle to endAngle, e.g. a gauge dial
+	@param x0 circle center x position
+	@param y0 circle center y position
+	@param r outer radius
+	@param thickness ring width in pixels, r + 1 or more fills a pie slice
+	@param startAngle degrees, 0 = 12 o'clock, 90 = 3 o'clock
+	@param endAngle degrees, an end before the start wraps past 12 o'clock, equal = full ring
+	@param color color of the arc , 565 16 Bit color
+	@note One window per span, at most two spans per row.
+*/
+void ST7735_TFT_graphics ::TFTfillArc(int16_t x0, int16_t y0, int16_t r, int16_t thickness, int16_t startAngle, int16_t endAngle, uint16_t color)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, r, thickness, startAngle, endAngle, (int16_t)color};
+		displayListRecord(TFTOp_FillArc, args, 7, nullptr, x0 - r, y0 - r, x0 + r, y0 + r, false);
+		return;
+	}
+	int16_t outer[TFT_MAX_ROW_PIXELS];
+	int16_t inner[TFT_MAX_ROW_PIXELS];
+	circleRuns(x0, y0, r, 0x0F, true, color, spanTableClear(outer));
+	spanTableClear(inner);
+	if (thickness <= r)
+		circleRuns(x0, y0, r - thickness, 0x0F, true, color, inner);
+	arcFilterSet(x0, y0, startAngle, endAngle);
+	fillSpans(x0, outer, inner, color);
+	_arcFilter.active = false;
+}
+
+/*!
+	@brief Circle span engine, walks one octant and emits its runs mirrored to the others
+	@param x0 center x
+	@param y0 center y
+	@param r radius
+	@param corners quadrants to draw, 0x1 top left 0x2 top right 0x4 bottom right 0x8 bottom left
+	@param axes also the four points on the axes, false for the round rectangle corners
+	@param color 565 16-bit
+	@param table nullptr to draw, else the per row half widths are collected for fillSpans
+	@note The pixels are those of the midpoint circle. Each row the octant keeps is one
+		horizontal run, the mirrored octant gives vertical runs, so the outline is sent
+		as runs instead of 8 pixels per step.
+*/
+void ST7735_TFT_graphics::circleRuns(int16_t x0, int16_t y0, int16_t r, uint8_t corners, bool axes, uint16_t color, int16_t *table)
 {
 	int16_t f, ddF_x, ddF_y, x, y;
 	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+	int16_t runStart = axes ? 0 : 1;
 	while (x < y)
 	{
 		if (f >= 0)
 		{
+			// y steps, the run on row y ends at x
+			if (x >= runStart)
+				quadrantRuns(x0, y0, runStart, x, y, corners, color, table);
+			runStart = x + 1;
 			y--;
 			ddF_y += 2;
 			f += ddF_y;
@@ -224,72 +432,238 @@ void ST7735_TFT_graphics ::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, u
 		x++;
 		ddF_x += 2;
 		f += ddF_x;
-		if (cornername & 0x4)
+	}
+	if (x >= runStart)
+		quadrantRuns(x0, y0, runStart, x, y, corners, color, table);
+}
+
+/*!
+	@brief Ellipse span engine, midpoint ellipse with horizontal runs where the slope is
+		under 1 and vertical runs past it, mirrored to the four quadrants
+	@param x0 center x
+	@param y0 center y
+	@param rx horizontal radius
+	@param ry vertical radius
+	@param color 565 16-bit
+	@param table nullptr to draw, else the per row half widths are collected for fillSpans
+*/
+void ST7735_TFT_graphics::ellipseRuns(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color, int16_t *table)
+{
+	if (rx < 0 || ry < 0)
+		return;
+	if (rx == ry)
+	{
+		circleRuns(x0, y0, rx, 0x0F, true, color, table);
+		return;
+	}
+	if (rx == 0 || ry == 0)
+	{
+		quadrantRun(x0, y0, 0, (ry == 0) ? rx : ry, 0, ry != 0, 0x0F, color, table);
+		return;
+	}
+	int32_t rx2 = (int32_t)rx * rx;
+	int32_t ry2 = (int32_t)ry * ry;
+	int16_t x = 0, y = ry;
+	int32_t px = 0, py = 2 * rx2 * y;
+	// Region 1, slope under 1, one run per row
+	int64_t p = ry2 - rx2 * ry + rx2 / 4;
+	int16_t runStart = 0, runEnd = -1;
+	while (px < py)
+	{
+		runEnd = x;
+		x++;
+		px += 2 * ry2;
+		if (p < 0)
 		{
-			TFTdrawPixel(x0 + x, y0 + y, color);
-			TFTdrawPixel(x0 + y, y0 + x, color);
+			p += ry2 + px;
 		}
-		if (cornername & 0x2)
+		else
 		{
-			TFTdrawPixel(x0 + x, y0 - y, color);
-			TFTdrawPixel(x0 + y, y0 - x, color);
+			quadrantRun(x0, y0, runStart, runEnd, y, false, 0x0F, color, table);
+			runStart = x;
+			runEnd = x - 1;
+			y--;
+			py -= 2 * rx2;
+			p += ry2 + px - py;
 		}
-		if (cornername & 0x8)
+	}
+	if (runEnd >= runStart)
+		quadrantRun(x0, y0, runStart, runEnd, y, false, 0x0F, color, table);
+	// Region 2, slope over 1, one run per column
+	p = (int64_t)ry2 * (x * x + x) + ry2 / 4 + (int64_t)rx2 * (y - 1) * (y - 1) - (int64_t)rx2 * ry2;
+	int16_t runTop = y;
+	while (y >= 0)
+	{
+		y--;
+		py -= 2 * rx2;
+		if (p > 0)
 		{
-			TFTdrawPixel(x0 - y, y0 + x, color);
-			TFTdrawPixel(x0 - x, y0 + y, color);
+			p += rx2 - py;
 		}
-		if (cornername & 0x1)
+		else
 		{
-			TFTdrawPixel(x0 - y, y0 - x, color);
-			TFTdrawPixel(x0 - x, y0 - y, color);
+			quadrantRun(x0, y0, y + 1, runTop, x, true, 0x0F, color, table);
+			runTop = y;
+			x++;
+			px += 2 * ry2;
+			p += rx2 - py + px;
 		}
 	}
+	if (runTop >= 0)
+		quadrantRun(x0, y0, 0, runTop, x, true, 0x0F, color, table);
 }
 
 /*!
-	@brief Used internally by fill circle TFTfillRoundRect and fillcircle
+	@brief A circle octant run and its mirror in the octant next to it
+	@param x0 center x
+	@param y0 center y
+	@param a first offset of the run
+	@param b last offset of the run
+	@param d row offset of the horizontal run, column offset of the mirrored vertical run
+	@param corners quadrants to draw
+	@param color 565 16-bit
+	@param table nullptr to draw, else collected for fillSpans
 */
-void ST7735_TFT_graphics ::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color)
+void ST7735_TFT_graphics::quadrantRuns(int16_t x0, int16_t y0, int16_t a, int16_t b, int16_t d, uint8_t corners, uint16_t color, int16_t *table)
 {
-	int16_t f, ddF_x, ddF_y, x, y;
-	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
-	while (x < y)
+	quadrantRun(x0, y0, a, b, d, false, corners, color, table);
+	quadrantRun(x0, y0, a, b, d, true, corners, color, table);
+}
+
+/*!
+	@brief Draw a run mirrored into the chosen quadrants, or collect it for a fill
+	@param x0 center x
+	@param y0 center y
+	@param a first offset of the run from the center
+	@param b last offset of the run from the center
+	@param d row offset of a horizontal run, column offset of a vertical run
+	@param vertical run direction
+	@param corners quadrants to draw, 0x1 top left 0x2 top right 0x4 bottom right 0x8 bottom left
+	@param color 565 16-bit
+	@param table nullptr to draw, else per screen row half widths, largest kept
+	@note Mirror images that meet on an axis are joined into one run.
+*/
+void ST7735_TFT_graphics::quadrantRun(int16_t x0, int16_t y0, int16_t a, int16_t b, int16_t d, bool vertical, uint8_t corners, uint16_t color, int16_t *table)
+{
+	if (table != nullptr)
 	{
-		if (f >= 0)
+		int16_t first = vertical ? a : d;
+		int16_t last = vertical ? b : d;
+		int16_t half = vertical ? d : b;
+		for (int16_t offset = first; offset <= last; offset++)
 		{
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
+			for (int16_t row = y0 - offset; row <= y0 + offset; row += (offset > 0) ? 2 * offset : 1)
+			{
+				if (row >= 0 && row < _heightTFT && table[row] < half)
+					table[row] = half;
+			}
 		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
+		return;
+	}
+	for (int16_t sign = -1; sign <= 1; sign += 2)
+	{
+		if (d == 0 && sign > 0)
+			break;
+		// the two quadrants on this side, they meet where the run starts on the axis
+		bool low = corners & (vertical ? ((sign < 0) ? 0x1 : 0x2) : ((sign < 0) ? 0x1 : 0x8));
+		bool high = corners & (vertical ? ((sign < 0) ? 0x8 : 0x4) : ((sign < 0) ? 0x2 : 0x4));
+		int16_t across = vertical ? x0 + sign * d : y0 + sign * d;
+		int16_t center = vertical ? y0 : x0;
+		if (a == 0 && low && high)
+		{
+			drawLineRun(vertical ? across : center - b, vertical ? center - b : across, center + b, vertical, color);
+			continue;
+		}
+		if (low)
+			drawLineRun(vertical ? across : center - b, vertical ? center - b : across, center - a, vertical, color);
+		if (high)
+			drawLineRun(vertical ? across : center + a, vertical ? center + a : across, center + b, vertical, color);
+	}
+}
+
+/*!
+	@brief Empty a per screen row half width table
+	@param table TFT_MAX_ROW_PIXELS entries
+	@return table
+*/
+int16_t *ST7735_TFT_graphics::spanTableClear(int16_t *table)
+{
+	for (uint16_t row = 0; row < TFT_MAX_ROW_PIXELS; row++)
+		table[row] = -1;
+	return table;
+}
 
-		if (cornername & 0x1)
+/*!
+	@brief Fill a shape one horizontal span per row from its half width table
+	@param x0 center x
+	@param outer per screen row half widths, -1 = row not in the shape
+	@param inner nullptr, or half widths of a hole, the row is then up to two spans
+	@param color 565 16-bit
+	@param middle straight part each span is widened by, to the right of x0
+	@note Rows of the same width with no hole are one rectangle, so the straight sides
+		of a round rectangle and the flat top of a circle are one window each.
+*/
+void ST7735_TFT_graphics::fillSpans(int16_t x0, const int16_t *outer, const int16_t *inner, uint16_t color, int16_t middle)
+{
+	for (int16_t row = 0; row < _heightTFT; row++)
+	{
+		int16_t half = outer[row];
+		if (half < 0)
+			continue;
+		int16_t hole = (inner != nullptr) ? inner[row] : -1;
+		if (hole < 0)
 		{
-			TFTdrawFastVLine(x0 + x, y0 - y, 2 * y + 1 + delta, color);
-			TFTdrawFastVLine(x0 + y, y0 - x, 2 * x + 1 + delta, color);
+			int16_t rows = 1;
+			while (!_arcFilter.active && row + rows < _heightTFT && outer[row + rows] == half && (inner == nullptr || inner[row + rows] < 0))
+				rows++;
+			int16_t left = (x0 - half < 0) ? 0 : x0 - half;
+			int16_t right = (x0 + middle + half >= _widthTFT) ? _widthTFT - 1 : x0 + middle + half;
+			if (rows == 1)
+				drawLineRun(x0 - half, row, x0 + middle + half, false, color);
+			else if (left <= right)
+				fillRectSolid(left, row, right - left + 1, rows, color);
+			row += rows - 1;
 		}
-		if (cornername & 0x2)
+		else if (hole < half)
 		{
-			TFTdrawFastVLine(x0 - x, y0 - y, 2 * y + 1 + delta, color);
-			TFTdrawFastVLine(x0 - y, y0 - x, 2 * x + 1 + delta, color);
+			drawLineRun(x0 - half, row, x0 - hole - 1, false, color);
+			drawLineRun(x0 + middle + hole + 1, row, x0 + middle + half, false, color);
 		}
 	}
 }
 
 /*!
-	@brief fills a circle where (x0,y0) are center coordinates an r is circle radius.
-	@param x0 circle center x position
-	@param y0 circle center y position
-	@param r radius of circle
-	@param color color of the circle , 565 16 Bit color
+	@brief Limit drawLineRun to a sector until _arcFilter.active is cleared
+	@param x0 center x
+	@param y0 center y
+	@param startAngle degrees clockwise from 12 o'clock
+	@param endAngle degrees clockwise from 12 o'clock
 */
-void ST7735_TFT_graphics ::TFTfillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+void ST7735_TFT_graphics::arcFilterSet(int16_t x0, int16_t y0, int16_t startAngle, int16_t endAngle)
+{
+	int16_t sweep = ((endAngle - startAngle) % 360 + 360) % 360;
+	float start = startAngle * (float)M_PI / 180.0f;
+	float end = endAngle * (float)M_PI / 180.0f;
+	// Direction vectors scaled by 1024, screen y points down
+	_arcFilter = {sweep != 0, sweep > 180, x0, y0,
+		(int32_t)(sinf(start) * 1024), (int32_t)(-cosf(start) * 1024),
+		(int32_t)(sinf(end) * 1024), (int32_t)(-cosf(end) * 1024)};
+}
+
+/*!
+	@brief Is a pixel inside the sector set by arcFilterSet
+	@param x screen x
+	@param y screen y
+	@return true if inside, edges included
+*/
+bool ST7735_TFT_graphics::arcFilterInside(int16_t x, int16_t y)
 {
-	TFTdrawFastVLine(x0, y0 - r, 2 * r + 1, color);
-	fillCircleHelper(x0, y0, r, 3, 0, color);
+	const ArcFilter_t &arc = _arcFilter;
+	int32_t dx = x - arc.x0;
+	int32_t dy = y - arc.y0;
+	bool afterStart = arc.startX * dy - arc.startY * dx >= 0;
+	bool beforeEnd = dx * arc.endY - dy * arc.endX >= 0;
+	return arc.wide ? (afterStart || beforeEnd) : (afterStart && beforeEnd);
 }
 
 /*!
@@ -315,9 +689,18 @@ void ST7735_TFT_graphics ::TFTdrawRectWH(uint8_t x, uint8_t y, uint8_t w, uint8_
 	@param x1 x end coordinate
 	@param y1 y end coordinate
 	@param color color to fill  rectangle 565 16-bit
+	@note Run slice Bresenham, the pixels are the same as stepping one at a time but
+		each horizontal run (vertical for a steep line) is sent as one window and burst.
 */
 void ST7735_TFT_graphics ::TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
 {
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, x1, y1, (int16_t)color};
+		displayListRecord(TFTOp_Line, args, 5, nullptr, (x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1,
+						  (x0 > x1) ? x0 : x1, (y0 > y1) ? y0 : y1, false);
+		return;
+	}
 	int16_t steep, dx, dy, err, ystep;
 	steep = abs(y1 - y0) > abs(x1 - x0);
 	if (steep)
@@ -343,17 +726,23 @@ void ST7735_TFT_graphics ::TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16
 		ystep = -1;
 	}
 
+	int16_t runStart = x0;
 	for (; x0 <= x1; x0++)
 	{
-		if (steep)
-		{
-			TFTdrawPixel(y0, x0, color);
-		}
-		else
+		err -= dy;
+		// The run ends where y steps or at the end of the line
+		if (err < 0 || x0 == x1)
 		{
-			TFTdrawPixel(x0, y0, color);
+			if (steep)
+			{
+				drawLineRun(y0, runStart, x0, true, color);
+			}
+			else
+			{
+				drawLineRun(runStart, y0, x0, false, color);
+			}
+			runStart = x0 + 1;
 		}
-		err -= dy;
 		if (err < 0)
 		{
 			y0 += ystep;
@@ -362,6 +751,52 @@ void ST7735_TFT_graphics ::TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16
 	}
 }
 
+/*!
+	@brief Draw one run of a line or shape clipped to the screen
+	@param x x start coordinate
+	@param y y start coordinate
+	@param end last x of a horizontal run, last y of a vertical run
+	@param vertical true for a vertical run
+	@param color 565 16-bit
+	@note While an arc is drawn only the pixels inside its sector are kept, the run
+		may then split into pieces.
+*/
+void ST7735_TFT_graphics::drawLineRun(int16_t x, int16_t y, int16_t end, bool vertical, uint16_t color)
+{
+	int16_t &start = vertical ? y : x;
+	int16_t limit = vertical ? _heightTFT : _widthTFT;
+	int16_t across = vertical ? x : y;
+	if (across < 0 || across >= (vertical ? _widthTFT : _heightTFT) || end < 0 || start >= limit)
+		return;
+	if (start < 0)
+		start = 0;
+	if (end >= limit)
+		end = limit - 1;
+	if (_arcFilter.active)
+	{
+		int16_t pieceStart = -1;
+		for (int16_t i = start; i <= end + 1; i++)
+		{
+			bool inside = i <= end && arcFilterInside(vertical ? x : i, vertical ? i : y);
+			if (inside && pieceStart < 0)
+				pieceStart = i;
+			if (!inside && pieceStart >= 0)
+			{
+				if (vertical)
+					fillRectSolid(x, pieceStart, 1, i - pieceStart, color);
+				else
+					fillRectSolid(pieceStart, y, i - pieceStart, 1, color);
+				pieceStart = -1;
+			}
+		}
+		return;
+	}
+	if (vertical)
+		fillRectSolid(x, y, 1, end - y + 1, color);
+	else
+		fillRectSolid(x, y, end - x + 1, 1, color);
+}
+
 /*!
 	@brief fills a rectangle at (x,y) where h is height and w is width of the rectangle.
 	@param x x start coordinate
@@ -369,14 +804,11 @@ void ST7735_TFT_graphics ::TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16
 	@param w width of the rectangle
 	@param h height of the rectangle
 	@param color color to fill  rectangle 565 16-bit
+	@note silently clipped to the screen, unlike TFTfillRectBuffer no error is reported
 */
 void ST7735_TFT_graphics ::TFTfillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color)
 {
-	int16_t i;
-	for (i = x; i < x + w; i++)
-	{
-		TFTdrawFastVLine(i, y, h, color);
-	}
+	fillRectSolid(x, y, w, h, color);
 }
 
 /*!
@@ -390,6 +822,12 @@ void ST7735_TFT_graphics ::TFTfillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t
 */
 void ST7735_TFT_graphics ::TFTdrawRoundRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t r, uint16_t color)
 {
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, h, r, (int16_t)color};
+		displayListRecord(TFTOp_RoundRect, args, 6, nullptr, x, y, x + w - 1, y + h - 1, false);
+		return;
+	}
 	TFTdrawFastHLine(x + r, y, w - 2 * r, color);
 	TFTdrawFastHLine(x + r, y + h - 1, w - 2 * r, color);
 	TFTdrawFastVLine(x, y + r, h - 2 * r, color);
@@ -411,9 +849,13 @@ void ST7735_TFT_graphics ::TFTdrawRoundRect(uint8_t x, uint8_t y, uint8_t w, uin
 */
 void ST7735_TFT_graphics ::TFTfillRoundRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t r, uint16_t color)
 {
-	TFTfillRect(x + r, y, w - 2 * r, h, color);
-	fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
-	fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, h, r, (int16_t)color};
+		displayListRecord(TFTOp_FillRoundRect, args, 6, nullptr, x, y, x + w - 1, y + h - 1, false);
+		return;
+	}
+	fillCircleHelper(x + r, y + r, r, w - 2 * r - 1, h - 2 * r - 1, color);
 }
 
 /*!
@@ -428,7 +870,16 @@ void ST7735_TFT_graphics ::TFTfillRoundRect(uint8_t x, uint8_t y, uint8_t w, uin
 */
 void ST7735_TFT_graphics ::TFTdrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
-	TFTdrawLine(x0, y0, x1, y1, color);
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, x1, y1, x2, y2, (int16_t)color};
+		int16_t left = (x0 < x1) ? x0 : x1, top = (y0 < y1) ? y0 : y1;
+		int16_t right = (x0 > x1) ? x0 : x1, bottom = (y0 > y1) ? y0 : y1;
+		displayListRecord(TFTOp_Triangle, args, 7, nullptr, (x2 < left) ? x2 : left, (y2 < top) ? y2 : top,
+						  (x2 > right) ? x2 : right, (y2 > bottom) ? y2 : bottom, false);
+		return;
+	}
+	TFTdrawLine(x0, y0, x1, y1, color);
 	TFTdrawLine(x1, y1, x2, y2, color);
 	TFTdrawLine(x2, y2, x0, y0, color);
 }
@@ -445,6 +896,15 @@ void ST7735_TFT_graphics ::TFTdrawTriangle(int16_t x0, int16_t y0, int16_t x1, i
 */
 void ST7735_TFT_graphics ::TFTfillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, x1, y1, x2, y2, (int16_t)color};
+		int16_t left = (x0 < x1) ? x0 : x1, top = (y0 < y1) ? y0 : y1;
+		int16_t right = (x0 > x1) ? x0 : x1, bottom = (y0 > y1) ? y0 : y1;
+		displayListRecord(TFTOp_FillTriangle, args, 7, nullptr, (x2 < left) ? x2 : left, (y2 < top) ? y2 : top,
+						  (x2 > right) ? x2 : right, (y2 > bottom) ? y2 : bottom, false);
+		return;
+	}
 	int16_t a, b, y, last, dx01, dy01, dx02, dy02, dx12, dy12, sa, sb;
 	// Sort coordinates by Y order (y2 >= y1 >= y0)
 	if (y0 > y1)
@@ -513,6 +973,444 @@ void ST7735_TFT_graphics ::TFTfillTriangle(int16_t x0, int16_t y0, int16_t x1, i
 	}
 }
 
+/*!
+	@brief Fills a polygon, convex or concave, with a scanline edge table
+	@param vertices x,y pairs, count pairs, the last vertex joins back to the first
+	@param count number of vertices, 3 to TFT_POLYGON_EDGES_MAX
+	@param color color to fill , 565 16-bit
+	@param rule which parts of a self crossing polygon are inside
+	@param fracBits 0-8, vertices are in 1/(2^fracBits) pixel units, e.g. 4 for 1/16 pixel
+	@return
+		-# Display_Success
+		-# Display_BufferNullptr vertices is a nullptr
+		-# Display_GenericError count or fracBits out of range
+	@note A pixel is filled when its center is inside. Rows with the same spans as the
+		row above are joined, so a band where the polygon is a rectangle is sent as
+		one address window. In tile mode the vertices are read again at each TFTflush,
+		keep the array until then.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTfillPolygon(const int16_t *vertices, uint8_t count, uint16_t color, TFT_Fill_rule_e rule, uint8_t fracBits)
+{
+	if (vertices == nullptr)
+	{
+		printf("Error TFTfillPolygon 1: Vertex array is a nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	if (count < 3 || count > TFT_POLYGON_EDGES_MAX || fracBits > 8)
+	{
+		printf("Error TFTfillPolygon 2: %u vertices, %u fraction bits, max %u and 8\r\n", count, fracBits, TFT_POLYGON_EDGES_MAX);
+		return Display_GenericError;
+	}
+	// 1. Edge table, coordinates in 16.16 fixed point, horizontal edges dropped
+	PolygonEdge_t edges[TFT_POLYGON_EDGES_MAX];
+	uint8_t edgeCount = 0;
+	int32_t top = INT32_MAX, bottom = INT32_MIN, left = INT32_MAX, right = INT32_MIN;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		uint8_t next = (i + 1 == count) ? 0 : i + 1;
+		int32_t x0 = (int32_t)vertices[2 * i] * (1 << (16 - fracBits));
+		int32_t y0 = (int32_t)vertices[2 * i + 1] * (1 << (16 - fracBits));
+		int32_t x1 = (int32_t)vertices[2 * next] * (1 << (16 - fracBits));
+		int32_t y1 = (int32_t)vertices[2 * next + 1] * (1 << (16 - fracBits));
+		top = (y0 < top) ? y0 : top;
+		bottom = (y0 > bottom) ? y0 : bottom;
+		left = (x0 < left) ? x0 : left;
+		right = (x0 > right) ? x0 : right;
+		if (y0 == y1)
+			continue;
+		PolygonEdge_t &edge = edges[edgeCount++];
+		edge.winding = (y1 > y0) ? 1 : -1;
+		if (y1 < y0)
+		{
+			_swap_TFT32(x0, x1);
+			_swap_TFT32(y0, y1);
+		}
+		edge.yTop = y0;
+		edge.yBottom = y1;
+		edge.xTop = x0;
+		edge.slope = (int32_t)(((int64_t)(x1 - x0) * 65536) / (y1 - y0));
+	}
+	if (displayListActive())
+	{
+		int16_t args[] = {(int16_t)count, (int16_t)color, (int16_t)rule, (int16_t)fracBits};
+		displayListRecord(TFTOp_Polygon, args, 4, vertices, left >> 16, top >> 16, right >> 16, bottom >> 16, false);
+		return Display_Success;
+	}
+
+	// 2. Each row sampled at its pixel centers, rows first and last hold a center inside top..bottom
+	int32_t rowFirst = (top + 0x7FFF) >> 16;
+	int32_t rowLast = ((bottom + 0x7FFF) >> 16) - 1;
+	if (rowFirst < 0)
+		rowFirst = 0;
+	if (rowLast >= _heightTFT)
+		rowLast = _heightTFT - 1;
+	int16_t spans[TFT_POLYGON_EDGES_MAX];
+	int16_t bandSpans[TFT_POLYGON_EDGES_MAX];
+	uint8_t spanCount = 0, bandSpanCount = 0;
+	int16_t bandTop = (int16_t)rowFirst;
+	for (int32_t row = rowFirst; row <= rowLast + 1; row++)
+	{
+		spanCount = 0;
+		if (row <= rowLast)
+		{
+			// crossings at the row center, sorted left to right
+			int32_t center = row * 65536 + 0x8000;
+			int32_t crossX[TFT_POLYGON_EDGES_MAX];
+			int8_t crossWinding[TFT_POLYGON_EDGES_MAX];
+			uint8_t crossCount = 0;
+			for (uint8_t e = 0; e < edgeCount; e++)
+			{
+				const PolygonEdge_t &edge = edges[e];
+				if (center < edge.yTop || center >= edge.yBottom)
+					continue;
+				int32_t x = edge.xTop + (int32_t)(((int64_t)(center - edge.yTop) * edge.slope) >> 16);
+				uint8_t at = crossCount++;
+				while (at > 0 && crossX[at - 1] > x)
+				{
+					crossX[at] = crossX[at - 1];
+					crossWinding[at] = crossWinding[at - 1];
+					at--;
+				}
+				crossX[at] = x;
+				crossWinding[at] = edge.winding;
+			}
+			// inside intervals to pixel spans, a pixel is in when its center is
+			int16_t winding = 0;
+			for (uint8_t c = 0; c + 1 < crossCount; c++)
+			{
+				winding += (rule == TFTFill_NonZero) ? crossWinding[c] : 1;
+				bool inside = (rule == TFTFill_NonZero) ? (winding != 0) : (winding & 1);
+				if (!inside)
+					continue;
+				int32_t first = (crossX[c] + 0x7FFF) >> 16;
+				int32_t last = ((crossX[c + 1] + 0x7FFF) >> 16) - 1;
+				if (first < 0)
+					first = 0;
+				if (last >= _widthTFT)
+					last = _widthTFT - 1;
+				if (first > last)
+					continue;
+				if (spanCount > 0 && first <= spans[spanCount - 1] + 1)
+				{
+					spans[spanCount - 1] = (int16_t)last;
+					continue;
+				}
+				spans[spanCount++] = (int16_t)first;
+				spans[spanCount++] = (int16_t)last;
+			}
+		}
+		// 3. Rows with the same spans form a band, sent as one rectangle per span
+		if (row > rowFirst && spanCount == bandSpanCount && memcmp(spans, bandSpans, spanCount * sizeof(int16_t)) == 0)
+			continue;
+		for (uint8_t i = 0; i < bandSpanCount; i += 2)
+			fillRectSolid(bandSpans[i], bandTop, bandSpans[i + 1] - bandSpans[i] + 1, row - bandTop, color);
+		memcpy(bandSpans, spans, spanCount * sizeof(int16_t));
+		bandSpanCount = spanCount;
+		bandTop = (int16_t)row;
+	}
+	return Display_Success;
+}
+
+/*!
+	@brief Draws an anti-aliased line (Xiaolin Wu), two blended pixels per step
+	@param x0 x start coordinate
+	@param y0 y start coordinate
+	@param x1 x end coordinate
+	@param y1 y end coordinate
+	@param color color to draw with, 565 16-bit
+	@param bg color behind the line, the blend target when drawing direct to the screen
+	@note In framebuffer and tile mode the line is blended with the pixels in the buffer
+		and bg is not used.
+*/
+void ST7735_TFT_graphics::TFTdrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, uint16_t bg)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, x1, y1, (int16_t)color, (int16_t)bg};
+		displayListRecord(TFTOp_LineAA, args, 6, nullptr, ((x0 < x1) ? x0 : x1) - 1, ((y0 < y1) ? y0 : y1) - 1,
+						  ((x0 > x1) ? x0 : x1) + 1, ((y0 > y1) ? y0 : y1) + 1, false);
+		return;
+	}
+	wuLine((int32_t)x0 * 65536, (int32_t)y0 * 65536, (int32_t)x1 * 65536, (int32_t)y1 * 65536, color, bg);
+}
+
+/*!
+	@brief Draws an anti-aliased circle outline
+	@param x0 center x position
+	@param y0 center y position
+	@param r radius
+	@param color color of the circle , 565 16 Bit color
+	@param bg color behind the circle, the blend target when drawing direct to the screen
+*/
+void ST7735_TFT_graphics::TFTdrawCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, r, (int16_t)color, (int16_t)bg};
+		displayListRecord(TFTOp_CircleAA, args, 5, nullptr, x0 - r - 1, y0 - r - 1, x0 + r + 1, y0 + r + 1, false);
+		return;
+	}
+	circleAA(x0, y0, r, color, bg, nullptr);
+}
+
+/*!
+	@brief Fills a circle with an anti-aliased edge
+	@param x0 center x position
+	@param y0 center y position
+	@param r radius
+	@param color color of the circle , 565 16 Bit color
+	@param bg color behind the circle, the blend target when drawing direct to the screen
+	@note The inside is one span per row, only the edge pixels are blended.
+*/
+void ST7735_TFT_graphics::TFTfillCircleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg)
+{
+	if (displayListActive())
+	{
+		int16_t args[] = {x0, y0, r, (int16_t)color, (int16_t)bg};
+		displayListRecord(TFTOp_FillCircleAA, args, 5, nullptr, x0 - r - 1, y0 - r - 1, x0 + r + 1, y0 + r + 1, false);
+		return;
+	}
+	int16_t halfWidth[TFT_MAX_ROW_PIXELS];
+	circleAA(x0, y0, r, color, bg, spanTableClear(halfWidth));
+	fillSpans(x0, halfWidth, nullptr, color);
+}
+
+/*!
+	@brief Fills a polygon with anti-aliased edges, see TFTfillPolygon
+	@param vertices x,y pairs, count pairs, the last vertex joins back to the first
+	@param count number of vertices, 3 to TFT_POLYGON_EDGES_MAX
+	@param color color to fill , 565 16-bit
+	@param bg color behind the polygon, the blend target when drawing direct to the screen
+	@param rule which parts of a self crossing polygon are inside
+	@param fracBits 0-8, vertices are in 1/(2^fracBits) pixel units
+	@return codes of TFTfillPolygon
+	@note The edges are drawn as Wu lines then the polygon is filled over them, so only
+		edge pixels whose center is outside keep a blend.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTfillPolygonAA(const int16_t *vertices, uint8_t count, uint16_t color, uint16_t bg, TFT_Fill_rule_e rule, uint8_t fracBits)
+{
+	if (vertices == nullptr || count < 3 || count > TFT_POLYGON_EDGES_MAX || fracBits > 8)
+		return TFTfillPolygon(vertices, count, color, rule, fracBits);
+	if (displayListActive())
+	{
+		int16_t left = INT16_MAX, top = INT16_MAX, right = INT16_MIN, bottom = INT16_MIN;
+		for (uint8_t i = 0; i < count; i++)
+		{
+			int16_t x = vertices[2 * i] >> fracBits, y = vertices[2 * i + 1] >> fracBits;
+			left = (x < left) ? x : left;
+			right = (x > right) ? x : right;
+			top = (y < top) ? y : top;
+			bottom = (y > bottom) ? y : bottom;
+		}
+		int16_t args[] = {(int16_t)count, (int16_t)color, (int16_t)bg, (int16_t)rule, (int16_t)fracBits};
+		displayListRecord(TFTOp_PolygonAA, args, 5, vertices, left - 1, top - 1, right + 1, bottom + 1, false);
+		return Display_Success;
+	}
+	// Polygon coordinates put pixel centers at +0.5, Wu lines at +0
+	for (uint8_t i = 0; i < count; i++)
+	{
+		uint8_t next = (i + 1 == count) ? 0 : i + 1;
+		wuLine((int32_t)vertices[2 * i] * (1 << (16 - fracBits)) - 0x8000, (int32_t)vertices[2 * i + 1] * (1 << (16 - fracBits)) - 0x8000,
+			   (int32_t)vertices[2 * next] * (1 << (16 - fracBits)) - 0x8000, (int32_t)vertices[2 * next + 1] * (1 << (16 - fracBits)) - 0x8000, color, bg);
+	}
+	return TFTfillPolygon(vertices, count, color, rule, fracBits);
+}
+
+/*!
+	@brief Wu line engine, 16.16 fixed point end points with pixel centers on whole numbers
+	@param x0 x start
+	@param y0 y start
+	@param x1 x end
+	@param y1 y end
+	@param color 565 16-bit
+	@param bg blend target when drawing direct to the screen
+	@note Each step along the major axis plots the two pixels the line passes between,
+		weighted by how close it passes to each.
+*/
+void ST7735_TFT_graphics::wuLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, uint16_t bg)
+{
+	bool steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep)
+	{
+		_swap_TFT32(x0, y0);
+		_swap_TFT32(x1, y1);
+	}
+	if (x0 > x1)
+	{
+		_swap_TFT32(x0, x1);
+		_swap_TFT32(y0, y1);
+	}
+	int32_t dx = x1 - x0;
+	int32_t gradient = (dx == 0) ? 0 : (int32_t)(((int64_t)(y1 - y0) * 65536) / dx);
+	int32_t first = (x0 + 0x8000) >> 16;
+	int32_t last = (x1 + 0x8000) >> 16;
+	if (first < 0)
+		first = 0;
+	if (last >= TFT_MAX_ROW_PIXELS)
+		last = TFT_MAX_ROW_PIXELS - 1;
+	for (int32_t step = first; step <= last; step++)
+	{
+		int32_t y = y0 + (int32_t)(((int64_t)(step * 65536 - x0) * gradient) >> 16);
+		int32_t minor = y >> 16;
+		uint8_t weight = (y >> 8) & 0xFF;
+		if (steep)
+		{
+			blendPixel(minor, step, color, bg, 255 - weight);
+			blendPixel(minor + 1, step, color, bg, weight);
+		}
+		else
+		{
+			blendPixel(step, minor, color, bg, 255 - weight);
+			blendPixel(step, minor + 1, color, bg, weight);
+		}
+	}
+}
+
+/*!
+	@brief Wu circle engine, the exact edge of each octant column split over two pixels
+	@param x0 center x
+	@param y0 center y
+	@param r radius
+	@param color 565 16-bit
+	@param bg blend target when drawing direct to the screen
+	@param table nullptr for an outline, else the inside half widths are collected for
+		fillSpans and only the outer edge pixels are blended
+*/
+void ST7735_TFT_graphics::circleAA(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint16_t bg, int16_t *table)
+{
+	if (r < 0)
+		return;
+	int32_t radius2 = (int32_t)r * r;
+	for (int16_t x = 0;; x++)
+	{
+		// edge height of column x in 8.8 fixed point
+		uint32_t edge = squareRoot((uint32_t)(radius2 - (int32_t)x * x) << 16);
+		int16_t y = edge >> 8;
+		uint8_t weight = edge & 0xFF;
+		if (x > y)
+			break;
+		if (table != nullptr)
+		{
+			for (int16_t sign = -1; sign <= 1; sign += 2)
+			{
+				int16_t rows[2] = {(int16_t)(y0 + sign * x), (int16_t)(y0 + sign * y)};
+				int16_t halves[2] = {y, x};
+				for (uint8_t i = 0; i < 2; i++)
+				{
+					if (rows[i] >= 0 && rows[i] < _heightTFT && table[rows[i]] < halves[i])
+						table[rows[i]] = halves[i];
+				}
+			}
+		}
+		else
+		{
+			circlePlotAA(x0, y0, x, y, color, bg, 255 - weight);
+		}
+		circlePlotAA(x0, y0, x, y + 1, color, bg, weight);
+	}
+}
+
+/*!
+	@brief Blend a pixel offset from a circle center into all eight octants
+	@param x0 center x
+	@param y0 center y
+	@param dx offset, dx <= dy
+	@param dy offset
+	@param color 565 16-bit
+	@param bg blend target when drawing direct to the screen
+	@param alpha coverage 0-255
+	@note Mirror images that land on the same pixel are plotted once, a buffer pixel
+		blended twice would come out too dark.
+*/
+void ST7735_TFT_graphics::circlePlotAA(int16_t x0, int16_t y0, int16_t dx, int16_t dy, uint16_t color, uint16_t bg, uint8_t alpha)
+{
+	for (uint8_t transpose = 0; transpose < 2; transpose++)
+	{
+		if (transpose && dx == dy)
+			break;
+		int16_t across = transpose ? dy : dx;
+		int16_t down = transpose ? dx : dy;
+		for (int16_t signX = -1; signX <= 1; signX += 2)
+		{
+			if (across == 0 && signX > 0)
+				break;
+			for (int16_t signY = -1; signY <= 1; signY += 2)
+			{
+				if (down == 0 && signY > 0)
+					break;
+				blendPixel(x0 + signX * across, y0 + signY * down, color, bg, alpha);
+			}
+		}
+	}
+}
+
+/*!
+	@brief Plot a pixel blended by coverage over what is behind it
+	@param x screen x
+	@param y screen y
+	@param color 565 16-bit
+	@param bg blend target when drawing direct to the screen, the buffer pixel is used
+		when drawing into a framebuffer or tile
+	@param alpha coverage 0-255
+*/
+void ST7735_TFT_graphics::blendPixel(int32_t x, int32_t y, uint16_t color, uint16_t bg, uint8_t alpha)
+{
+	if (alpha == 0 || x < 0 || y < 0 || x >= _widthTFT || y >= _heightTFT)
+		return;
+	if (_ramTarget.buffer != nullptr)
+	{
+		const RamTarget_t &target = _ramTarget;
+		if (x < target.x || y < target.y || x >= target.x + target.w || y >= target.y + target.h)
+			return;
+		bg = ramTargetGet((uint32_t)(y - target.y) * target.w + (x - target.x));
+	}
+	TFTdrawPixel(x, y, blend565(color, bg, (alpha + 4) >> 3));
+}
+
+/*!
+	@brief Blend two 565 colors with integer math
+	@param color 565 16-bit foreground
+	@param bg 565 16-bit background
+	@param alpha 0-32, 32 is all color
+	@return blended 565 color
+	@note Green is moved to the top half of a 32 bit word so red, green and blue each have
+		room for the product, all three channels then take one multiply.
+*/
+uint16_t ST7735_TFT_graphics::blend565(uint16_t color, uint16_t bg, uint8_t alpha)
+{
+	uint32_t foreground = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+	uint32_t background = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+	uint32_t blended = ((((foreground - background) * alpha) >> 5) + background) & 0x07E0F81F;
+	return (uint16_t)(blended | (blended >> 16));
+}
+
+/*!
+	@brief Integer square root
+	@param value input
+	@return largest root whose square is not over value
+*/
+uint32_t ST7735_TFT_graphics::squareRoot(uint32_t value)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1u << 30;
+	while (bit > value)
+		bit >>= 2;
+	while (bit != 0)
+	{
+		if (value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
 /*!
 	@brief  writes a character on the TFT
 	@param  x X coordinate
@@ -526,13 +1424,14 @@ void ST7735_TFT_graphics ::TFTfillTriangle(int16_t x0, int16_t y0, int16_t x1, i
 		-# Display_WrongFont = Wrong font This Function for font #1-6 only.
 		-# Display_CharScreenBounds = X  Y Co-ordinates out of bounds.
 		-# Display_CharFontASCIIRange = ASCII character not in fonts range.
-	@note Function Overloaded 2 off , the other drawChar method is for fonts > 6
+	@note Function Overloaded 2 off , the other drawChar method is for fonts > 6.
+		With a background the character is one address window, with bg == color
+		only its foreground runs are drawn.
 */
 Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawChar(uint8_t x, uint8_t y, uint8_t character, uint16_t color, uint16_t bg, uint8_t size)
 {
 
-	int8_t i, j;
-	uint8_t line;
+	uint8_t i, j;
 	// 0. Check size
 	if (size == 0 || size >= 15)
 		size = 1;
@@ -553,59 +1452,51 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawChar(uint8_t x, uint8_t y, u
 		return  Display_CharFontASCIIRange;
 	}
 
-	for (i = 0; i < (_CurrentFontWidth + 1); i++)
+	// 3. Check for correct font
+	if (_font->layout != TFTFontLayout_Scalable || _propFont != nullptr)
 	{
+		printf("Error TFTdrawChar 5: Wrong font number set must be 1-6 : %u \r\n", _FontNumber);
+		return Display_WrongFont;
+	}
 
-		if (i == _CurrentFontWidth)
-		{
-			line = 0x00;
-		}
-		else
-		{
-			switch (_FontNumber)
-			{
-			case TFTFont_Default:
-				line = pFontDefaultptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Thick:
-				line = pFontThickptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Seven_Seg:
-				line = pFontSevenSegptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Wide:
-				line = pFontWideptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Tiny:
-				line = pFontTinyptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_HomeSpun:
-				line = pFontHomeSpunptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			default:
-				printf("Error TFTdrawChar 5: Wrong font number set must be 1-6 : %u \r\n", _FontNumber);
-				return Display_WrongFont;
-				break;
-			}
-		}
-		for (j = 0; j < _CurrentFontheight; j++, line >>= 1)
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, character, (int16_t)color, (int16_t)bg, size, _FontNumber};
+		displayListRecord(TFTOp_Char, args, 7, nullptr, x, y, x + (_CurrentFontWidth + 1) * size - 1,
+						  y + _CurrentFontheight * size - 1, bg != color);
+		return Display_Success;
+	}
+
+	// 4. A cached image of the glyph needs no font decoding
+	uint8_t glyphWidth = _CurrentFontWidth + 1;
+	if (bg != color && glyphCacheSend(x, y, glyphWidth * size, _CurrentFontheight * size, character, color, bg, size))
+		return Display_Success;
+	GlyphBits_t bits;
+	glyphLookup(character, size, bits);
+
+	// 5. Transparent background, one rectangle per run of set pixels in each glyph row
+	if (bg == color)
+	{
+		for (j = 0; j < _CurrentFontheight; j++)
 		{
-			if (line & 0x01)
-			{
-				if (size == 1)
-					TFTdrawPixel(x + i, y + j, color);
-				else
-					TFTfillRect(x + (i * size), y + (j * size), size, size, color);
-			}
-			else if (bg != color)
+			int8_t runStart = -1;
+			for (i = 0; i <= glyphWidth; i++)
 			{
-				if (size == 1)
-					TFTdrawPixel(x + i, y + j, bg);
-				else
-					TFTfillRect(x + i * size, y + j * size, size, size, bg);
+				bool set = (i < bits.columns) && ((bits.data[i] >> j) & 0x01);
+				if (set && runStart < 0)
+					runStart = i;
+				if (!set && runStart >= 0)
+				{
+					fillRectSolid(x + runStart * size, y + j * size, (i - runStart) * size, size, color);
+					runStart = -1;
+				}
 			}
 		}
+		return Display_Success;
 	}
+
+	// 6. Opaque, the scaled glyph is one address window
+	glyphDraw(x, y, glyphWidth * size, _CurrentFontheight * size, bits, character, color, bg);
 	return Display_Success;
 }
 
@@ -638,7 +1529,7 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawText(uint8_t x, uint8_t y, c
 {
 
 	// Check if correct font
-	if (_FontNumber >= TFTFont_Bignum)
+	if (_font->layout != TFTFontLayout_Scalable || _propFont != nullptr)
 	{
 		printf("Error TFTdrawText 2: Wrong font number selected, must be 1-6\r\n");
 		return Display_WrongFont;
@@ -655,8 +1546,12 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawText(uint8_t x, uint8_t y, c
 		printf("Error TFTdrawText 4: Out of screen bounds\r\n");
 		return Display_CharScreenBounds;
 	}
+	if (size == 0 || size >= 15)
+		size = 1;
 	uint8_t cursorX = x;
 	uint8_t cursorY = y;
+	uint8_t advance = size * (_CurrentFontWidth + 1);
+	bool runs = textRunsActive(color, bg);
 	Display_Return_Codes_e  errorCode;
 	while (*pText != '\0')
 	{
@@ -667,17 +1562,27 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawText(uint8_t x, uint8_t y, c
 			if (cursorY > _heightTFT)
 				cursorY = _heightTFT;
 		}
-		errorCode = TFTdrawChar(cursorX, cursorY, *pText, color, bg, size);
+		// With a background the characters up to the wrap point or screen edge are one window
+		uint8_t count = 1;
+		if (runs)
+		{
+			while (pText[count] != '\0' && count < TFT_TEXT_RUN_MAX &&
+				   cursorX + count * advance < _widthTFT &&
+				   !(_wrap && (cursorX + count * advance + size * _CurrentFontWidth) > _widthTFT))
+				count++;
+			errorCode = textRunDraw(cursorX, cursorY, pText, count, advance, color, bg, size);
+		}
+		else
+		{
+			errorCode = TFTdrawChar(cursorX, cursorY, *pText, color, bg, size);
+		}
 		if ( errorCode != Display_Success)
 		{
 			printf("Error TFTdrawText 5: Method TFTdrawChar failed\r\n");
 			return errorCode;
 		}
-		cursorX = cursorX + size * (_CurrentFontWidth + 1);
-
-		if (cursorX > _widthTFT)
-			cursorX = _widthTFT;
-		pText++;
+		cursorX = (cursorX + count * advance > _widthTFT) ? _widthTFT : cursorX + count * advance;
+		pText += count;
 	}
 	return Display_Success;
 }
@@ -691,7 +1596,37 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawText(uint8_t x, uint8_t y, c
 */
 size_t ST7735_TFT_graphics ::write(uint8_t character)
 {
-	if (_FontNumber < TFTFont_Bignum)
+	if (_propFont != nullptr)
+	{
+		switch (character)
+		{
+		case '\n':
+			_cursorY += _propFont->height;
+			_cursorX = 0;
+			_kernLeft = 0;
+			_utf8Count = 0;
+			break;
+		case '\r': /* skip */
+			break;
+		default:
+			// The bytes of a UTF-8 sequence wait until it is complete
+			_utf8Pending[_utf8Count++] = character;
+			while (_utf8Count > 0)
+			{
+				uint16_t code;
+				uint8_t length = utf8Decode(_utf8Pending, _utf8Count, code);
+				if (length == 0)
+					break;
+				bool printed = propCharPrint(code, _utf8Pending, length);
+				_utf8Count -= length;
+				memmove(_utf8Pending, _utf8Pending + length, _utf8Count);
+				if (!printed)
+					return -1;
+			}
+			break;
+		}
+	}
+	else if (_font->layout == TFTFontLayout_Scalable)
 	{
 		switch (character)
 		{
@@ -746,134 +1681,202 @@ size_t ST7735_TFT_graphics ::write(uint8_t character)
 
 /*!
 	@brief   Set the font type
-	@param FontNumber 1-12 enum OLED_FONT_TYPE_e
+	@param FontNumber 1-12 enum OLED_FONT_TYPE_e, or 13-16 if registered with TFTFontRegister
+	@note The font's descriptor is looked up here once, an unknown or unregistered
+		font number selects the default font. A font set by TFTsetFont is dropped.
 */
 void ST7735_TFT_graphics ::TFTFontNum(TFT_Font_Type_e FontNumber)
 {
-	_FontNumber = FontNumber;
-	switch (_FontNumber)
+	const TFT_Font_t *font = nullptr;
+	if (FontNumber >= TFTFont_Default && FontNumber <= TFT_FONT_BUILTIN)
+		font = &TFTFontTable[FontNumber - TFTFont_Default];
+	else if (FontNumber >= TFTFont_User1 && FontNumber < TFTFont_User1 + TFT_FONT_USER_MAX)
+		font = _fontUser[FontNumber - TFTFont_User1];
+	if (font == nullptr)
 	{
-	case TFTFont_Default: // Norm default 5 by 8
-		_CurrentFontWidth = TFTFont_width_5;
-		_CurrentFontoffset = TFTFont_offset_none;
-		_CurrentFontheight = TFTFont_height_8;
-		_CurrentFontLength = TFTFontLenAll;
-		break;
-	case TFTFont_Thick: // Thick 7 by 8 (NO LOWERCASE LETTERS)
-		_CurrentFontWidth = TFTFont_width_7;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_8;
-		_CurrentFontLength = TFTFontLenAlphaNumNoLCase;
-		break;
-	case TFTFont_Seven_Seg: // Seven segment 4 by 8
-		_CurrentFontWidth = TFTFont_width_4;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_8;
-		_CurrentFontLength = TFTFontLenAlphaNum;
-		break;
-	case TFTFont_Wide: // Wide  8 by 8 (NO LOWERCASE LETTERS)
-		_CurrentFontWidth = TFTFont_width_8;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_8;
-		_CurrentFontLength = TFTFontLenAlphaNumNoLCase;
-		break;
-	case TFTFont_Tiny: // tiny 3 by 8
-		_CurrentFontWidth = TFTFont_width_3;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_8;
-		_CurrentFontLength = TFTFontLenAlphaNum;
-		break;
-	case TFTFont_HomeSpun: // homespun 7 by 8
-		_CurrentFontWidth = TFTFont_width_7;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_8;
-		_CurrentFontLength = TFTFontLenAlphaNum;
-		break;
-	case TFTFont_Bignum: // big nums 16 by 32 (NUMBERS + : only)
-		_CurrentFontWidth = TFTFont_width_16;
-		_CurrentFontoffset = TFTFont_offset_minus;
-		_CurrentFontheight = TFTFont_height_32;
-		_CurrentFontLength = TFTFontLenNumeric;
-		break;
-	case TFTFont_Mednum: // med nums 16 by 16 (NUMBERS + : only)
-		_CurrentFontWidth = TFTFont_width_16;
-		_CurrentFontoffset = TFTFont_offset_minus;
-		_CurrentFontheight = TFTFont_height_16;
-		_CurrentFontLength = TFTFontLenNumeric;
-		break;
-	case TFTFont_ArialRound: // Arial round 16 by 24
-		_CurrentFontWidth = TFTFont_width_16;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_24;
-		_CurrentFontLength = TFTFontLenAlphaNum;
-		break;
-	case TFTFont_ArialBold: // Arial bold  16 by 16
-		_CurrentFontWidth = TFTFont_width_16;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_16;
-		_CurrentFontLength = TFTFontLenAlphaNum;
-		break;
-	case TFTFont_Mia: // mia  8 by 16
-		_CurrentFontWidth = TFTFont_width_8;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_16;
-		_CurrentFontLength = TFTFontLenAlphaNum;
-		break;
-	case TFTFont_Dedica: // dedica  6 by 12
-		_CurrentFontWidth = TFTFont_width_6;
-		_CurrentFontoffset = TFTFont_offset_space;
-		_CurrentFontheight = TFTFont_height_12;
-		_CurrentFontLength = TFTFontLenAlphaNum;
-		break;
-	default:
-		_CurrentFontWidth = TFTFont_width_5;
-		_CurrentFontoffset = TFTFont_offset_none;
-		_CurrentFontheight = TFTFont_height_8;
-		_CurrentFontLength = TFTFontLenAll;
-		_FontNumber = TFTFont_Default;
-		break;
+		font = &TFTFontTable[0];
+		FontNumber = TFTFont_Default;
 	}
+	_FontNumber = FontNumber;
+	_font = font;
+	_propFont = nullptr;
+	_CurrentFontWidth = font->width;
+	_CurrentFontoffset = font->offset;
+	_CurrentFontheight = font->height;
+	_CurrentFontLength = font->length;
 }
 
 /*!
-	@brief Draws an custom Icon of X by 8 size to screen , where X = 0 to 127
-	@param x X coordinate
-	@param y Y coordinate
-	@param w 0-MAX_Y possible values width of icon in pixels , height is fixed at 8 pixels
-	@param color icon foreground colors ,is bi-color
-	@param backcolor icon background colors ,is bi-color
-	@param character  An array of unsigned chars containing icon data vertically addressed.
+	@brief Add a user font, it is then selected with TFTFontNum like a built in font
+	@param FontNumber TFTFont_User1 to TFTFont_User4
+	@param font the font's descriptor, it and its data must stay valid, a constexpr
+		TFT_Font_t keeps both in flash
 	@return
-		-# Display_Success=success.
-		-# Display_BitmapScreenBounds=Co-ordinates out of bounds.
-		-# Display_BitmapNullptr=invalid pointer object.
-		-# Display_IconScreenWidth=Icon width is greater than screen width
+		-# Display_Success=success
+		-# Display_WrongFont=FontNumber is not a user font number
+		-# Display_FontPtrNullptr=font or its data is nullptr
+	@note A TFTFontLayout_Scalable font is drawn with the TFTdrawChar and TFTdrawText
+		that take a size, a TFTFontLayout_Column font with the ones that do not.
+		Registering over the current font selects the new one, the glyph cache is cleared.
 */
-Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawIcon(uint8_t x, uint8_t y, uint8_t w, uint16_t color, uint16_t backcolor, const unsigned char character[])
+Display_Return_Codes_e ST7735_TFT_graphics::TFTFontRegister(TFT_Font_Type_e FontNumber, const TFT_Font_t *font)
 {
-	// Out of screen bounds
-	if ((x >= _widthTFT) || (y >= _heightTFT))
+	if (FontNumber < TFTFont_User1 || FontNumber >= TFTFont_User1 + TFT_FONT_USER_MAX)
 	{
-		printf("Error TFTdrawIcon 2: Out of screen bounds\r\n");
-		return Display_BitmapScreenBounds;
+		printf("Error TFTFontRegister 1: Font number must be %u-%u : %u\r\n", TFTFont_User1, TFTFont_User1 + TFT_FONT_USER_MAX - 1, FontNumber);
+		return Display_WrongFont;
 	}
-	// Check for null pointer
-	if (character == nullptr)
+	if (font == nullptr || font->data == nullptr)
 	{
-		printf("Error TFTdrawIcon 3: Icon array is not valid pointer object\r\n");
-		return Display_BitmapNullptr;
+		printf("Error TFTFontRegister 2: Font is not a valid pointer object\r\n");
+		return Display_FontPtrNullptr;
 	}
-	// Check w value
-	if (w >= _widthTFT)
+	_fontUser[FontNumber - TFTFont_User1] = font;
+	TFTglyphCacheClear();
+	if (_FontNumber == FontNumber && _propFont == nullptr)
+		TFTFontNum(FontNumber);
+	return Display_Success;
+}
+
+/*!
+	@brief Set a proportional font, drawn by the TFTdrawChar and TFTdrawText without a size and print
+	@param font the font, it and its data must stay valid, e.g. &TFTFontPropDefault
+	@return
+		-# Display_Success=success
+		-# Display_FontPtrNullptr=font or its data is nullptr
+		-# Display_FontNotEnabled=unknown glyph encoding
+	@note Each character takes its own xAdvance plus any kerning with the one before,
+		only the set pixels inside each glyph's box are stored. TFTFontNum goes back
+		to the fixed width fonts. The glyph cache is not used for proportional fonts.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetFont(const TFT_PropFont_t *font)
+{
+	if (font == nullptr || font->bitmap == nullptr || font->glyphs == nullptr)
 	{
-		printf("Error TFTdrawIcon 4: Icon is greater than Screen width\r\n");
-		return Display_IconScreenWidth;
+		printf("Error TFTsetFont 1: Font is not a valid pointer object\r\n");
+		return Display_FontPtrNullptr;
 	}
-
-	uint8_t value;
-	for (uint8_t byte = 0; byte < w; byte++)
+	if (font->encoding > TFTGlyph_Gray4)
 	{
-		for (uint8_t mybit = 0; mybit < 8; mybit++)
+		printf("Error TFTsetFont 2: Glyph encoding %u not supported\r\n", font->encoding);
+		return Display_FontNotEnabled;
+	}
+	_propFont = font;
+	_kernLeft = 0;
+	_utf8Count = 0;
+	return Display_Success;
+}
+
+/*!
+	@brief Print one character of the proportional font at the cursor, then move it on
+	@param code Unicode code point
+	@param pBytes the character's UTF-8 bytes
+	@param length bytes in pBytes
+	@return true if drawn
+*/
+bool ST7735_TFT_graphics::propCharPrint(uint16_t code, const char *pBytes, uint8_t length)
+{
+	const TFT_Glyph_t *glyph = propGlyph(code);
+	if (glyph == nullptr)
+	{
+		printf("Error write_print method 3A: Character = U+%04X not in font\r\n", code);
+		return false;
+	}
+	if (_kernLeft != 0)
+		_cursorX += propKern(_kernLeft, code);
+	if (_wrap && _cursorX > 0 && _cursorX + glyph->xAdvance > _widthTFT)
+	{
+		_cursorY += _propFont->height;
+		_cursorX = 0;
+	}
+	if (_cursorX < 0)
+		_cursorX = 0;
+	if (propTextDraw(_cursorX, _cursorY, pBytes, length, _textcolor, _textbgcolor) != Display_Success)
+	{
+		printf("Error write_print method 3C: Method drawChar failed\r\n");
+		return false;
+	}
+	_cursorX += glyph->xAdvance;
+	_kernLeft = code;
+	return true;
+}
+
+/*!
+	@brief Width in pixels of a string drawn in the current font, on one line
+	@param pText pointer to string, UTF-8 for a proportional font
+	@return width, characters not in a proportional font count as 0
+	@note Fonts 1-6 at the print text size, fonts 7-16 at their one size.
+*/
+uint16_t ST7735_TFT_graphics::TFTtextWidth(const char *pText)
+{
+	if (pText == nullptr)
+		return 0;
+	if (_propFont == nullptr)
+	{
+		uint16_t advance = (_font->layout == TFTFontLayout_Scalable) ? _textSize * (_CurrentFontWidth + 1) : _CurrentFontWidth;
+		return strlen(pText) * advance;
+	}
+	int16_t width = 0;
+	uint16_t code, previous = 0;
+	while (*pText != '\0')
+	{
+		pText += utf8Decode(pText, 4, code);
+		const TFT_Glyph_t *glyph = propGlyph(code);
+		if (glyph == nullptr)
+			continue;
+		if (previous != 0)
+			width += propKern(previous, code);
+		width += glyph->xAdvance;
+		previous = code;
+	}
+	return (width > 0) ? width : 0;
+}
+
+/*!
+	@brief Draws an custom Icon of X by 8 size to screen , where X = 0 to 127
+	@param x X coordinate
+	@param y Y coordinate
+	@param w 0-MAX_Y possible values width of icon in pixels , height is fixed at 8 pixels
+	@param color icon foreground colors ,is bi-color
+	@param backcolor icon background colors ,is bi-color
+	@param character  An array of unsigned chars containing icon data vertically addressed.
+	@return
+		-# Display_Success=success.
+		-# Display_BitmapScreenBounds=Co-ordinates out of bounds.
+		-# Display_BitmapNullptr=invalid pointer object.
+		-# Display_IconScreenWidth=Icon width is greater than screen width
+*/
+Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawIcon(uint8_t x, uint8_t y, uint8_t w, uint16_t color, uint16_t backcolor, const unsigned char character[])
+{
+	// Out of screen bounds
+	if ((x >= _widthTFT) || (y >= _heightTFT))
+	{
+		printf("Error TFTdrawIcon 2: Out of screen bounds\r\n");
+		return Display_BitmapScreenBounds;
+	}
+	// Check for null pointer
+	if (character == nullptr)
+	{
+		printf("Error TFTdrawIcon 3: Icon array is not valid pointer object\r\n");
+		return Display_BitmapNullptr;
+	}
+	// Check w value
+	if (w >= _widthTFT)
+	{
+		printf("Error TFTdrawIcon 4: Icon is greater than Screen width\r\n");
+		return Display_IconScreenWidth;
+	}
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, (int16_t)color, (int16_t)backcolor};
+		displayListRecord(TFTOp_Icon, args, 5, character, x, y, x + w - 1, y + 7, true);
+		return Display_Success;
+	}
+
+	uint8_t value;
+	for (uint8_t byte = 0; byte < w; byte++)
+	{
+		for (uint8_t mybit = 0; mybit < 8; mybit++)
 		{
 			value = !!(character[byte] & (1 << mybit));
 			if (value)
@@ -912,7 +1915,6 @@ Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap(int16_t x, int16_t y,
 {
 	int16_t byteWidth = (w + 7) / 8;
 	uint8_t byte = 0;
-	uint16_t mycolor = 0;
 
 	// Validate size of the bitmap
 	if (sizeOfBitmap != ((w / 8) * h))
@@ -932,17 +1934,22 @@ Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap(int16_t x, int16_t y,
 		printf("Error TFTdrawBitmap 2: Out of screen bounds, check x & y\r\n");
 		return Display_BitmapScreenBounds;
 	}
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, h, (int16_t)color, (int16_t)bgcolor, (int16_t)sizeOfBitmap};
+		displayListRecord(TFTOp_Bitmap, args, 7, pBmp, x, y, x + w - 1, y + h - 1, true);
+		return Display_Success;
+	}
 	if ((x + w - 1) >= _widthTFT)
 		w = _widthTFT - x;
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
-	// Buffer for one row of pixels (16-bit per pixel split into bytes)
-	uint8_t rowBuffer[w * 2];
-
-	// Draw row by row
+	// Draw row by row, each row is built in one ping-pong buffer while the last is on the wire
 	for (int16_t j = 0; j < h; j++)
 	{
+		// Buffer for one row of RGB565 pixels
+		uint16_t *rowBuffer = rowBufferNext();
 		// Process one row of pixels
 		for (int16_t i = 0; i < w; i++)
 		{
@@ -950,17 +1957,14 @@ Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap(int16_t x, int16_t y,
 				byte <<= 1;
 			else
 				byte = pBmp[j * byteWidth + i / 8];
-			mycolor = (byte & 0x80) ? color : bgcolor;
-			// Correct order: High byte first, low byte second
-			rowBuffer[2 * i] = mycolor >> 8;      // High byte
-			rowBuffer[2 * i + 1] = mycolor & 0xFF; // Low byte
+			rowBuffer[i] = (byte & 0x80) ? color : bgcolor;
 		}
 
 		// Set the address window for the current row
 		TFTsetAddrWindow(x, y + j, x + w - 1, y + j);
 
-		// Write the row to the display
-		spiWriteDataBuffer(rowBuffer, w * 2);
+		// Queue the row to the display
+		spiWritePixelBufferAsync(rowBuffer, w);
 	}
 
 	return Display_Success;
@@ -977,10 +1981,12 @@ Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap(int16_t x, int16_t y,
 		-# Display_Success=success
 		-# Display_BitmapNullptr=invalid pointer object
 		-# Display_BitmapScreenBounds=Co-ordinates out of bounds
+	@note With DMA the data is read after return, do not modify pBmp until TFTwaitIdle()
 */
 Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap16Data(uint8_t x, uint8_t y, uint8_t *pBmp, uint8_t w, uint8_t h)
 {
 	uint8_t j = 0;
+	uint16_t rowStride = w * sizeof(uint16_t);
 
 	// 1. Check for null pointer
 	if (pBmp == nullptr)
@@ -995,19 +2001,90 @@ Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap16Data(uint8_t x, uint8
 		printf("Error TFTdrawBitmap16 2: Out of screen bounds\r\n");
 		return Display_BitmapScreenBounds;
 	}
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, h};
+		displayListRecord(TFTOp_Bitmap16, args, 4, pBmp, x, y, x + w - 1, y + h - 1, true);
+		return Display_Success;
+	}
 	if ((x + w - 1) >= _widthTFT)
 		w = _widthTFT - x;
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
+	// Not clipped horizontally, rows are contiguous so send the whole bitmap in one transfer
+	if (w * sizeof(uint16_t) == rowStride)
+	{
+		TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+		spiWriteDataBufferAsync(pBmp, (uint32_t)rowStride * h);
+		return Display_Success;
+	}
 	// Process bitmap data row-by-row
 	for (j = 0; j < h; j++)
 	{
 		TFTsetAddrWindow(x, y + j, x + w - 1, y + j); // Set the window for the current row
-		spiWriteDataBuffer(pBmp, w * sizeof(uint16_t)); // Write one row of pixel data
-		pBmp += w * 2; // Move to the next row in the bitmap
+		spiWriteDataBufferAsync(pBmp, w * sizeof(uint16_t)); // Queue one row of pixel data
+		pBmp += rowStride; // Move to the next row in the bitmap
+	}
+
+	return Display_Success;
+}
+
+/*!
+	@brief: Draws a 16-bit color bitmap to the screen from a native RGB565 uint16_t array
+	@param x X coordinate
+	@param y Y coordinate
+	@param pBmp pointer to data array, one uint16_t per pixel
+	@param w width of the bitmap in pixels
+	@param h height of the bitmap in pixels
+	@return
+		-# Display_Success=success
+		-# Display_BitmapNullptr=invalid pointer object
+		-# Display_BitmapScreenBounds=Co-ordinates out of bounds
+	@note Sent with 16 bit SPI frames straight from the array, no byte swap copy.
+		With DMA the data is read after return, do not modify pBmp until TFTwaitIdle()
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap565Data(uint8_t x, uint8_t y, const uint16_t *pBmp, uint8_t w, uint8_t h)
+{
+	uint8_t j = 0;
+	uint8_t rowStride = w;
+
+	// 1. Check for null pointer
+	if (pBmp == nullptr)
+	{
+		printf("Error TFTdrawBitmap565 1: Bitmap array is nullptr\r\n");
+		return Display_BitmapNullptr;
 	}
+	// Check bounds
+	if ((x >= _widthTFT) || (y >= _heightTFT))
+	{
+		printf("Error TFTdrawBitmap565 2: Out of screen bounds\r\n");
+		return Display_BitmapScreenBounds;
+	}
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, h};
+		displayListRecord(TFTOp_Bitmap565, args, 4, pBmp, x, y, x + w - 1, y + h - 1, true);
+		return Display_Success;
+	}
+	if ((x + w - 1) >= _widthTFT)
+		w = _widthTFT - x;
+	if ((y + h - 1) >= _heightTFT)
+		h = _heightTFT - y;
 
+	// Not clipped horizontally, rows are contiguous so send the whole bitmap in one transfer
+	if (w == rowStride)
+	{
+		TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+		spiWritePixelBufferAsync(pBmp, (uint32_t)w * h);
+		return Display_Success;
+	}
+	for (j = 0; j < h; j++)
+	{
+		TFTsetAddrWindow(x, y + j, x + w - 1, y + j);
+		spiWritePixelBufferAsync(pBmp, w);
+		pBmp += rowStride;
+	}
 	return Display_Success;
 }
 
@@ -1027,7 +2104,7 @@ Display_Return_Codes_e ST7735_TFT_graphics::TFTdrawBitmap16Data(uint8_t x, uint8
 Display_Return_Codes_e  ST7735_TFT_graphics::TFTdrawBitmap24Data(uint8_t x, uint8_t y, uint8_t *pBmp, uint8_t w, uint8_t h)
 {
 	uint8_t i, j;
-	uint16_t color, red, green, blue;
+	uint16_t red, green, blue;
 
 	// 1. Check for null pointer
 	if (pBmp == nullptr)
@@ -1042,17 +2119,22 @@ Display_Return_Codes_e  ST7735_TFT_graphics::TFTdrawBitmap24Data(uint8_t x, uint
 		printf("Error TFTdrawBitmap24 2: Out of screen bounds\r\n");
 		return Display_BitmapScreenBounds;
 	}
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, h};
+		displayListRecord(TFTOp_Bitmap24, args, 4, pBmp, x, y, x + w - 1, y + h - 1, true);
+		return Display_Success;
+	}
 	if ((x + w - 1) >= _widthTFT)
 		w = _widthTFT - x;
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
-	// Buffer for one row of pixels (16-bit per pixel split into bytes)
-	uint8_t rowBuffer[w * 2];
-
-	// Draw the bitmap row by row
+	// Draw the bitmap row by row, each row is converted while the last is on the wire
 	for (j = 0; j < h; j++)
 	{
+		// Buffer for one row of RGB565 pixels
+		uint16_t *rowBuffer = rowBufferNext();
 		for (i = 0; i < w; i++)
 		{
 			// Extract RGB values from 24-bit color data
@@ -1060,15 +2142,12 @@ Display_Return_Codes_e  ST7735_TFT_graphics::TFTdrawBitmap24Data(uint8_t x, uint
 			green = *pBmp++;
 			blue = *pBmp++;
 			// Convert to 16-bit RGB565 format
-			color = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
-			// Store high and low bytes of the color in the row buffer
-			rowBuffer[2 * i] = color >> 8;      // High byte
-			rowBuffer[2 * i + 1] = color & 0xFF; // Low byte
+			rowBuffer[i] = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
 		}
 		// Set the address window for the current row
 		TFTsetAddrWindow(x, y + j, x + w - 1, y + j);
-		// Write the row to the display
-		spiWriteDataBuffer(rowBuffer, w * 2);
+		// Queue the row to the display
+		spiWritePixelBufferAsync(rowBuffer, w);
 	}
 	return Display_Success;
 }
@@ -1086,13 +2165,14 @@ Display_Return_Codes_e  ST7735_TFT_graphics::TFTdrawBitmap24Data(uint8_t x, uint
 		-# Display_CharScreenBounds=Co-ordinates out of bounds,
 		-# Display_CharFontASCIIRange=ASCII character not in fonts range,
 		-# Display_FontNotEnabled=Font selected but not enabled in _font.hpp
-	@note for font 7-12 only
+	@note for font 7-12 and TFTsetFont fonts only. The column ordered glyph is turned
+		into rows and sent through one address window. A proportional glyph is drawn
+		xAdvance pixels wide, with bg == color only its set pixels are drawn.
 */
 Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawChar(uint8_t x, uint8_t y, uint8_t character, uint16_t color, uint16_t bg)
 {
-	uint8_t FontSizeMod = 0;
-	uint8_t i, j;
-	uint8_t ctemp = 0, y0 = y;
+	if (_propFont != nullptr)
+		return propTextDraw(x, y, (const char *)&character, 1, color, bg);
 
 	// 1. Check for screen out of bounds
 	if ((x >= _widthTFT) ||					 // Clip right
@@ -1111,82 +2191,32 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawChar(uint8_t x, uint8_t y, u
 		return Display_CharFontASCIIRange;
 	}
 
-	// 3. Check for correct font and set FontSizeMod for fonts 7-12
-	switch (_FontNumber)
+	// 3. Check for correct font, fonts 7-12
+	if (_font->layout == TFTFontLayout_Scalable)
 	{
-	case TFTFont_Bignum:
-	case TFTFont_Mednum:
-	case TFTFont_ArialRound:
-	case TFTFont_ArialBold:
-		FontSizeMod = 2;
-		break;
-	case TFTFont_Mia:
-	case TFTFont_Dedica:
-		FontSizeMod = 1;
-		break;
-	default:
 		printf("Error TFTdrawChar 5B: Wrong font selected, Font must be > 7 : %u\r\n", _FontNumber);
 		return Display_WrongFont;
-		break;
 	}
 
-	for (i = 0; i < _CurrentFontheight * FontSizeMod; i++)
+	if (displayListActive())
 	{
-		switch (_FontNumber)
-		{
-		case TFTFont_Bignum:
-			ctemp = pFontBigNum16x32ptr[character - _CurrentFontoffset][i];
-			break;
-		case TFTFont_Mednum:
-			ctemp = pFontMedNum16x16ptr[character - _CurrentFontoffset][i];
-			break;
-#ifdef _TFT_OPTIONAL_FONT_9
-		case TFTFont_ArialRound:
-			ctemp = pFontArial16x24ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-#ifdef _TFT_OPTIONAL_FONT_10
-		case TFTFont_ArialBold:
-			ctemp = pFontArial16x16ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-#ifdef _TFT_OPTIONAL_FONT_11
-		case TFTFont_Mia:
-			ctemp = pFontMia8x16ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-#ifdef _TFT_OPTIONAL_FONT_12
-		case TFTFont_Dedica:
-			ctemp = pFontDedica6x12ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-		default:
-			printf("Error TFTdrawChar 6B: Is the font you selected enabled in _font.hpp? : %u\r\n", _FontNumber);
-			return Display_FontNotEnabled;
-			break;
-		}
+		int16_t args[] = {x, y, character, (int16_t)color, (int16_t)bg, _FontNumber};
+		displayListRecord(TFTOp_CharBig, args, 6, nullptr, x, y, x + _CurrentFontWidth - 1, y + _CurrentFontheight - 1, true);
+		return Display_Success;
+	}
 
-		for (j = 0; j < 8; j++)
-		{
-			if (ctemp & 0x80)
-			{
-				TFTdrawPixel(x, y, color);
-			}
-			else
-			{
-				TFTdrawPixel(x, y, bg);
-			}
+	// 4. A cached image of the glyph needs no font decoding
+	if (glyphCacheSend(x, y, _CurrentFontWidth, _CurrentFontheight, character, color, bg, 1))
+		return Display_Success;
 
-			ctemp <<= 1;
-			y++;
-			if ((y - y0) == _CurrentFontheight)
-			{
-				y = y0;
-				x++;
-				break;
-			}
-		}
+	// 5. Turned into rows, the glyph is one address window and one stream
+	GlyphBits_t bits;
+	if (!glyphLookup(character, 1, bits))
+	{
+		printf("Error TFTdrawChar 6B: Is the font you selected enabled in _font.hpp? : %u\r\n", _FontNumber);
+		return Display_FontNotEnabled;
 	}
+	glyphDraw(x, y, _CurrentFontWidth, _CurrentFontheight, bits, character, color, bg);
 	return Display_Success;
 }
 
@@ -1203,12 +2233,14 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawChar(uint8_t x, uint8_t y, u
 		-# Display_CharScreenBounds=Co-ordinates out of bounds
 		-# Display_FontPtrNullptr=Invalid pointer object
 		-# if TFTdrawChar method error upstream it return that error code.
-	@note for font 7-12 only
+	@note for font 7-12 and TFTsetFont fonts only. A proportional font lays out each line,
+		kerning included, up to where the next character would not fit, into one window.
+		Text in a proportional font is UTF-8, fonts 1-16 take one byte per character.
 */
 Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawText(uint8_t x, uint8_t y, char *pText, uint16_t color, uint16_t bg)
 {
 	// Check for correct font
-	if (_FontNumber < TFTFont_Bignum)
+	if (_font->layout == TFTFontLayout_Scalable && _propFont == nullptr)
 	{
 		printf("Error TFTdrawText 2B: Wrong font selected, must be 7 to 12 \r\n");
 		return Display_WrongFont;
@@ -1226,6 +2258,64 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawText(uint8_t x, uint8_t y, c
 		return Display_CharScreenBounds;
 	}
 	Display_Return_Codes_e  errorCode;
+	uint16_t code, previous = 0;
+	while (_propFont != nullptr && *pText != '\0')
+	{
+		// The UTF-8 characters that fit on the line are one run, count is in bytes
+		uint8_t count = 0;
+		int16_t width = 0;
+		bool full = false;
+		while (pText[count] != '\0')
+		{
+			uint8_t length = utf8Decode(pText + count, 4, code);
+			if (count + length > TFT_TEXT_RUN_MAX)
+				break;
+			const TFT_Glyph_t *glyph = propGlyph(code);
+			if (glyph == nullptr)
+			{
+				count += length; // propTextDraw reports it
+				break;
+			}
+			int16_t next = width + glyph->xAdvance + (count > 0 ? propKern(previous, code) : 0);
+			if (x + next > _widthTFT)
+			{
+				full = true;
+				break;
+			}
+			width = next;
+			count += length;
+			previous = code;
+		}
+		if (count == 0 && x == 0)
+			count = utf8Decode(pText, 4, previous); // wider than the screen, clipped
+		if (count > 0)
+		{
+			errorCode = propTextDraw(x, y, pText, count, color, bg);
+			if (errorCode != Display_Success)
+			{
+				printf("Error TFTdrawText 5B: TFTdrawChar method failed\r\n");
+				return errorCode;
+			}
+			pText += count;
+			x = (x + width > _widthTFT) ? _widthTFT : x + width;
+		}
+		if (full)
+		{
+			x = 0;
+			y += _propFont->height;
+			if (y > (_heightTFT - _propFont->height))
+				y = 0;
+		}
+		else if (*pText != '\0')
+		{
+			utf8Decode(pText, 4, code);
+			int16_t kerned = x + propKern(previous, code);
+			x = (kerned < 0) ? 0 : (kerned > _widthTFT ? _widthTFT : kerned);
+		}
+	}
+	if (_propFont != nullptr)
+		return Display_Success;
+	bool runs = textRunsActive(color, bg);
 	while (*pText != '\0')
 	{
 		if (x > (_widthTFT - _CurrentFontWidth))
@@ -1237,133 +2327,2226 @@ Display_Return_Codes_e ST7735_TFT_graphics ::TFTdrawText(uint8_t x, uint8_t y, c
 				y = x = 0;
 			}
 		}
-		errorCode = TFTdrawChar(x, y, *pText, color, bg);
+		// The characters up to the wrap point are one window
+		uint8_t count = 1;
+		if (runs)
+		{
+			while (pText[count] != '\0' && count < TFT_TEXT_RUN_MAX &&
+				   x + count * _CurrentFontWidth <= _widthTFT - _CurrentFontWidth)
+				count++;
+			errorCode = textRunDraw(x, y, pText, count, _CurrentFontWidth, color, bg, 1);
+		}
+		else
+		{
+			errorCode = TFTdrawChar(x, y, *pText, color, bg);
+		}
 		if (errorCode != Display_Success)
 		{
 			printf("Error TFTdrawText 5B: TFTdrawChar method failed\r\n");
 			return errorCode;
 		}
-		x += _CurrentFontWidth;
-		pText++;
+		x += count * _CurrentFontWidth;
+		pText += count;
 	}
 	return Display_Success;
 }
 
 /*!
-	@brief: Convert: 24-bit color to 565 16-bit color
-	@param r color red
-	@param g color green
-	@param b color blue
-	@return 16 bit color value
-	@note 3 byte to 2 byte,  Red Green Blue.
-		  RRRR RRRR GGGG GGGG BBBB BBBB => 565 color mode => RRRRR GGGGGG BBBBB
+	@brief Keep expanded RGB565 images of recently drawn characters, for text with a background
+	@param buffer user array of slots * slotPixels RGB565 pixels
+	@param sizePixels size of buffer in pixels
+	@param slots number of glyphs held, 1 to TFT_GLYPH_CACHE_MAX, nullptr buffer or 0 turns the cache off
+	@return
+		-# Display_Success=success
+		-# Display_BufferSize=slot count out of range
+	@note Each slot holds sizePixels / slots pixels. A glyph is kept per font, character,
+		colors and size, the least recently used is replaced. A hit is one address window
+		and one DMA transfer straight from the slot, no font decoding. Glyphs larger than
+		a slot, clipped by the screen edge or with bg == color are drawn as before.
+		e.g. 8 slots of 512 pixels (8KB) hold eight 16x32 Bignum digits or size 2 font 1.
 */
-uint16_t ST7735_TFT_graphics::Color565(uint16_t r, uint16_t g, uint16_t b)
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetGlyphCache(uint16_t *buffer, uint32_t sizePixels, uint8_t slots)
 {
-	return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+	if (slots > TFT_GLYPH_CACHE_MAX)
+	{
+		printf("Error TFTsetGlyphCache 1: Slot count 1-%u\r\n", TFT_GLYPH_CACHE_MAX);
+		return Display_BufferSize;
+	}
+	TFTwaitIdle();
+	_glyphCache = (slots == 0) ? nullptr : buffer;
+	_glyphSlotCount = (_glyphCache == nullptr) ? 0 : slots;
+	_glyphSlotPixels = (_glyphSlotCount == 0) ? 0 : sizePixels / slots;
+	TFTglyphCacheClear();
+	return Display_Success;
 }
 
 /*!
- * @brief pushColor
- * @param color
- * @note not in use currently.
- */
-void ST7735_TFT_graphics ::pushColor(uint16_t color)
+	@brief Empty the glyph cache and zero its hit and miss counters
+	@note Not needed when colors change, they are part of the key.
+*/
+void ST7735_TFT_graphics::TFTglyphCacheClear(void)
 {
-	uint8_t hi, lo;
-	hi = color >> 8;
-	lo = color;
-	TFT_DC_SetHigh;
-	TFT_CS_SetLow;
-	spiWrite(hi);
-	spiWrite(lo);
-	TFT_CS_SetHigh;
+	for (uint8_t slot = 0; slot < TFT_GLYPH_CACHE_MAX; slot++)
+		_glyphSlots[slot] = {0, 0, 0, 0, 0, 0};
+	_glyphHits = 0;
+	_glyphMisses = 0;
 }
 
 /*!
-	@brief : Write an SPI command to TFT
-	@param command byte to send
+	@brief Characters drawn from the glyph cache since it was set or cleared
+	@return hit count
 */
-void ST7735_TFT_graphics::writeCommand(uint8_t command)
+uint32_t ST7735_TFT_graphics::TFTglyphCacheHits(void)
 {
-	TFT_DC_SetLow;
-	TFT_CS_SetLow;
-	spiWrite(command);
-	TFT_CS_SetHigh;
+	return _glyphHits;
 }
 
 /*!
-	@brief Write an SPI data byte to device
-	@param dataByte byte to send
+	@brief Cacheable characters that had to be decoded since the cache was set or cleared
+	@return miss count
 */
-void ST7735_TFT_graphics ::writeData(uint8_t dataByte)
+uint32_t ST7735_TFT_graphics::TFTglyphCacheMisses(void)
 {
-	TFT_DC_SetHigh;
-	TFT_CS_SetLow;
-	spiWrite(dataByte);
-	TFT_CS_SetHigh;
+	return _glyphMisses;
 }
 
 /*!
-	@brief  Write byte to SPI
-	@param spiData byte to write
+	@brief Draw a character from the glyph cache if it is there
+	@param x X coordinate
+	@param y Y coordinate
+	@param w glyph width in pixels, scaled
+	@param h glyph height in pixels, scaled
+	@param character The ASCII character
+	@param color 565 16-bit
+	@param bg background color
+	@param size font 1-6 size, 1 for fonts 7-12
+	@return true if sent, false to decode and draw it
 */
-void ST7735_TFT_graphics::spiWrite(uint8_t spiData)
+bool ST7735_TFT_graphics::glyphCacheSend(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t character, uint16_t color, uint16_t bg, uint8_t size)
 {
-	if (_hardwareSPI == false)
-	{
-		spiWriteSoftware(spiData);
-	}
-	else
+	if (_glyphCache == nullptr)
+		return false;
+	for (uint8_t slot = 0; slot < _glyphSlotCount; slot++)
 	{
-		spi_write_blocking(_pspiInterface, &spiData, 1);
+		GlyphSlot_t &entry = _glyphSlots[slot];
+		if (entry.font == _FontNumber && entry.character == character && entry.size == size && entry.color == color && entry.bg == bg)
+		{
+			if (x + w > _widthTFT || y + h > _heightTFT)
+				return false;
+			entry.lastUse = ++_glyphClock;
+			_glyphHits++;
+			TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+			spiWritePixelBufferAsync(_glyphCache + slot * _glyphSlotPixels, (uint32_t)w * h);
+			return true;
+		}
 	}
+	return false;
 }
 
 /*!
-	@brief Write a byte to SPI using software SPI
-	@param spiData byte to send
-	@note uses _SWSPIGPIODelay to slowdown software SPI if CPU frequency too fast
+	@brief Expand a glyph through one address window, into a glyph cache slot when it can be kept
+	@param x X coordinate
+	@param y Y coordinate
+	@param w glyph width in pixels, scaled
+	@param h glyph height in pixels, scaled
+	@param bits the glyph's font data
+	@param character The ASCII character, cache key
+	@param color 565 16-bit
+	@param bg background color
+	@note Not kept, the rows are packed into the ping-pong row buffers as they are built.
 */
-void ST7735_TFT_graphics::spiWriteSoftware(uint8_t spiData)
+void ST7735_TFT_graphics::glyphDraw(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const GlyphBits_t &bits, uint8_t character, uint16_t color, uint16_t bg)
 {
-	uint8_t i;
-	for (i = 0; i < 8; i++)
+	bool whole = (x + w <= _widthTFT) && (y + h <= _heightTFT);
+	if (x + w > _widthTFT)
+		w = _widthTFT - x;
+	if (y + h > _heightTFT)
+		h = _heightTFT - y;
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+
+	// 1. Kept, replace the least recently used slot and send from it
+	if (_glyphCache != nullptr && whole && (uint32_t)w * h <= _glyphSlotPixels)
 	{
-		TFT_SDATA_SetLow;
-		if (spiData & 0x80)
-			TFT_SDATA_SetHigh;
-		TFT_SCLK_SetHigh;
-		if (_SWSPIGPIODelay > 0)
-			TFT_MICROSEC_DELAY(_SWSPIGPIODelay);
-		spiData <<= 1;
-		TFT_SCLK_SetLow;
-		if (_SWSPIGPIODelay > 0)
-			TFT_MICROSEC_DELAY(_SWSPIGPIODelay);
+		uint8_t victim = 0;
+		for (uint8_t slot = 1; slot < _glyphSlotCount; slot++)
+		{
+			if (_glyphSlots[slot].lastUse < _glyphSlots[victim].lastUse)
+				victim = slot;
+		}
+		uint16_t *image = _glyphCache + victim * _glyphSlotPixels;
+		if (_dmaBusy && _dmaSource == image)
+			TFTwaitIdle();
+		for (uint8_t row = 0; row < h; row++)
+			glyphExpandRow(bits, row, image + row * w, w, color, bg);
+		_glyphSlots[victim] = {_FontNumber, character, bits.size, color, bg, ++_glyphClock};
+		_glyphMisses++;
+		spiWritePixelBufferAsync(image, (uint32_t)w * h);
+		return;
 	}
-}
 
-/*!
-	@brief  Write a buffer to SPI, both Software and hardware SPI supported
-	@param spiData to send
+	// 2. Not kept, as many rows per row buffer as fit
+	uint16_t *glyphBuffer = nullptr;
+	uint16_t used = 0;
+	for (uint8_t row = 0; row < h; row++)
+	{
+		if (glyphBuffer == nullptr)
+		{
+			glyphBuffer = rowBufferNext();
+			used = 0;
+		}
+		glyphExpandRow(bits, row, glyphBuffer + used, w, color, bg);
+		used += w;
+		if (used + w > TFT_MAX_ROW_PIXELS || row == h - 1)
+		{
+			spiWritePixelBufferAsync(glyphBuffer, used);
+			glyphBuffer = nullptr;
+		}
+	}
+}
+
+/*!
+	@brief Expand one row of a glyph to RGB565
+	@param bits the glyph's font data
+	@param row row of the scaled glyph
+	@param dest w pixels
+	@param w pixels to expand, from the left
+	@param color 565 16-bit
+	@param bg background color
+*/
+void ST7735_TFT_graphics::glyphExpandRow(const GlyphBits_t &bits, uint8_t row, uint16_t *dest, uint8_t w, uint16_t color, uint16_t bg)
+{
+	uint8_t bitRow = row / bits.size;
+	const uint8_t *rowByte = bits.data + bitRow / 8;
+	uint8_t mask = bits.msbTop ? (0x80 >> (bitRow & 7)) : (0x01 << (bitRow & 7));
+	uint8_t column = 0;
+	for (uint8_t source = 0; column < w; source++)
+	{
+		uint16_t pixel = (source < bits.columns && (rowByte[source * bits.bytesPerColumn] & mask)) ? color : bg;
+		for (uint8_t repeat = 0; repeat < bits.size && column < w; repeat++)
+			dest[column++] = pixel;
+	}
+}
+
+/*!
+	@brief Find a character's glyph in the current font
+	@param character The ASCII character, in the font's range
+	@param size font 1-6 size, 1 for fonts 7-12
+	@param bits filled with where the glyph is and how it is stored
+	@return false if the font is not enabled in _font.hpp
+	@note See TFT_Font_Layout_e for how the glyph bits are stored.
+*/
+bool ST7735_TFT_graphics::glyphLookup(uint8_t character, uint8_t size, GlyphBits_t &bits)
+{
+	if (_font->data == nullptr)
+		return false;
+	uint8_t index = character - _CurrentFontoffset;
+	if (_font->layout == TFTFontLayout_Scalable)
+	{
+		bits = {_font->data + index * _CurrentFontWidth, 1, _CurrentFontWidth, false, size};
+		return true;
+	}
+	uint8_t bytesPerColumn = (_CurrentFontheight + 7) / 8;
+	bits = {_font->data + index * bytesPerColumn * _CurrentFontWidth, bytesPerColumn, _CurrentFontWidth, true, 1};
+	return true;
+}
+
+/*!
+	@brief Whether TFTdrawText lays out whole lines with textRunDraw
+	@param color 565 16-bit
+	@param bg background color
+	@return true for text with a background drawn straight to a target
+	@note In tile mode each character is recorded on its own, with a glyph cache
+		each character is sent from the cache, bg == color text has no background to fill.
+*/
+bool ST7735_TFT_graphics::textRunsActive(uint16_t color, uint16_t bg)
+{
+	return bg != color && _glyphCache == nullptr && !displayListActive();
+}
+
+/*!
+	@brief Draw characters side by side as one address window, the line is built row by row
+	@param x X coordinate
+	@param y Y coordinate
+	@param pText first character
+	@param count characters in the run, up to TFT_TEXT_RUN_MAX
+	@param advance pixels from one character to the next, spacing column included
+	@param color 565 16-bit
+	@param bg background color
+	@param size font 1-6 size, 1 for fonts 7-12
+	@return
+		-# Display_Success
+		-# Display_CharScreenBounds=Co-ordinates out of bounds
+		-# Display_CharFontASCIIRange=a character not in the font, the ones before it are drawn
+		-# Display_FontNotEnabled=Font selected but not enabled in _font.hpp
+	@note Errors are as TFTdrawChar would give them for the same characters.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::textRunDraw(uint8_t x, uint8_t y, const char *pText, uint8_t count, uint8_t advance, uint16_t color, uint16_t bg, uint8_t size)
+{
+	if (x >= _widthTFT || y >= _heightTFT)
+	{
+		printf("Error textRunDraw 1: Co-ordinates out of bounds\r\n");
+		return Display_CharScreenBounds;
+	}
+	// 1. Look up every glyph, stop at one the font does not have
+	Display_Return_Codes_e errorCode = Display_Success;
+	const uint8_t *glyphs[TFT_TEXT_RUN_MAX];
+	GlyphBits_t bits;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		uint8_t character = pText[i];
+		if (character < _CurrentFontoffset || character >= (_CurrentFontLength + _CurrentFontoffset))
+		{
+			printf("Error textRunDraw 2: Character = %u , Out of Font bounds %u <-> %u\r\n", character, _CurrentFontoffset, (unsigned int)(_CurrentFontLength + _CurrentFontoffset));
+			errorCode = Display_CharFontASCIIRange;
+			count = i;
+			break;
+		}
+		if (!glyphLookup(character, size, bits))
+		{
+			printf("Error textRunDraw 3: Is the font you selected enabled in _font.hpp? : %u\r\n", _FontNumber);
+			return Display_FontNotEnabled;
+		}
+		glyphs[i] = bits.data;
+	}
+	if (count == 0)
+		return errorCode;
+
+	// 2. One window over the run, clipped by the screen, rows packed into the row buffers
+	uint16_t w = (uint16_t)count * advance;
+	uint16_t h = _CurrentFontheight * size;
+	if (x + w > _widthTFT)
+		w = _widthTFT - x;
+	if (y + h > _heightTFT)
+		h = _heightTFT - y;
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	uint16_t *lineBuffer = nullptr;
+	uint16_t used = 0;
+	for (uint8_t row = 0; row < h; row++)
+	{
+		if (lineBuffer == nullptr)
+		{
+			lineBuffer = rowBufferNext();
+			used = 0;
+		}
+		for (uint8_t i = 0; i < count && i * advance < w; i++)
+		{
+			bits.data = glyphs[i];
+			uint16_t left = i * advance;
+			glyphExpandRow(bits, row, lineBuffer + used + left, (left + advance > w) ? w - left : advance, color, bg);
+		}
+		used += w;
+		if (used + w > TFT_MAX_ROW_PIXELS || row == h - 1)
+		{
+			spiWritePixelBufferAsync(lineBuffer, used);
+			lineBuffer = nullptr;
+		}
+	}
+	return errorCode;
+}
+
+/*!
+	@brief Find a character's glyph in the proportional font
+	@param code Unicode code point
+	@return the glyph, nullptr if the font does not have it
+	@note first to last is a direct index. Other code points are a binary search of the
+		font's sparse codes, the result is kept in a direct-mapped cache for the next time.
+*/
+const TFT_Glyph_t *ST7735_TFT_graphics::propGlyph(uint16_t code)
+{
+	if (code >= _propFont->first && code <= _propFont->last)
+		return &_propFont->glyphs[code - _propFont->first];
+	if (_propFont->codes == nullptr || code == 0)
+		return nullptr;
+
+	// 1. The cache holds lookups in one font, emptied when the font changes
+	if (_glyphIndexFont != _propFont)
+	{
+		for (GlyphIndexSlot_t &slot : _glyphIndex)
+			slot = {0, 0};
+		_glyphIndexFont = _propFont;
+	}
+	GlyphIndexSlot_t &slot = _glyphIndex[code & (TFT_GLYPH_INDEX_CACHE - 1)];
+
+	// 2. On a miss, binary search of the sorted codes, their glyphs follow first to last
+	if (slot.code != code)
+	{
+		uint16_t dense = (_propFont->last >= _propFont->first) ? _propFont->last - _propFont->first + 1 : 0;
+		slot = {code, UINT16_MAX};
+		int32_t low = 0, high = _propFont->codeCount - 1;
+		while (low <= high)
+		{
+			int32_t middle = (low + high) / 2;
+			if (_propFont->codes[middle] == code)
+			{
+				slot.glyph = dense + middle;
+				break;
+			}
+			if (_propFont->codes[middle] < code)
+				low = middle + 1;
+			else
+				high = middle - 1;
+		}
+	}
+	return (slot.glyph == UINT16_MAX) ? nullptr : &_propFont->glyphs[slot.glyph];
+}
+
+/*!
+	@brief Decode one UTF-8 character
+	@param pText first byte
+	@param length bytes that can be read, a NUL ends the text sooner
+	@param code the code point, U+FFFD for those above U+FFFF
+	@return bytes used, 0 if length ends the sequence early
+	@note A byte that does not start a valid sequence is taken as its Latin-1 code point,
+		so 8 bit text for fonts with characters up to 0xFF still draws.
+*/
+uint8_t ST7735_TFT_graphics::utf8Decode(const char *pText, uint8_t length, uint16_t &code)
+{
+	uint8_t lead = pText[0];
+	uint8_t extra = (lead >= 0xF0) ? 3 : (lead >= 0xE0) ? 2 : (lead >= 0xC2) ? 1 : 0;
+	code = lead;
+	if (extra == 0 || lead > 0xF4)
+		return 1;
+	uint32_t value = lead & (0x3F >> extra);
+	for (uint8_t i = 1; i <= extra; i++)
+	{
+		if (i >= length)
+			return 0;
+		uint8_t next = pText[i];
+		if ((next & 0xC0) != 0x80)
+			return 1;
+		value = (value << 6) | (next & 0x3F);
+	}
+	// Overlong forms, surrogates and values past U+10FFFF are not valid
+	if ((extra == 2 && (value < 0x800 || (value >= 0xD800 && value <= 0xDFFF))) ||
+		(extra == 3 && (value < 0x10000 || value > 0x10FFFF)))
+		return 1;
+	code = (value > 0xFFFF) ? 0xFFFD : value;
+	return extra + 1;
+}
+
+/*!
+	@brief Kerning of a pair of characters in the proportional font
+	@param left first character
+	@param right character drawn after it
+	@return pixels to add to the left character's xAdvance, 0 if the pair is not in the table
+	@note Binary search, the table is sorted by left then right. Pairs are of characters up to 0xFF.
+*/
+int8_t ST7735_TFT_graphics::propKern(uint16_t left, uint16_t right)
+{
+	if (_propFont->kerning == nullptr || left > 0xFF || right > 0xFF)
+		return 0;
+	uint16_t key = (left << 8) | right;
+	int16_t low = 0, high = _propFont->kernCount - 1;
+	while (low <= high)
+	{
+		int16_t middle = (low + high) / 2;
+		const TFT_Kern_t &pair = _propFont->kerning[middle];
+		uint16_t pairKey = (pair.left << 8) | pair.right;
+		if (pairKey == key)
+			return pair.adjust;
+		if (pairKey < key)
+			low = middle + 1;
+		else
+			high = middle - 1;
+	}
+	return 0;
+}
+
+/*!
+	@brief Draw a run of characters in the proportional font on one line
+	@param x X coordinate
+	@param y Y coordinate, top of the line
+	@param pText first character, UTF-8
+	@param count bytes in the run, up to TFT_TEXT_RUN_MAX
+	@param color 565 16-bit
+	@param bg background color
+	@return
+		-# Display_Success
+		-# Display_CharScreenBounds=Co-ordinates out of bounds
+		-# Display_CharFontASCIIRange=a character not in the font, the ones before it are drawn
+	@note With a background the run, xAdvance wide per character, is one address window
+		and a kerned pair can share columns. With bg == color one rectangle is drawn per
+		run of set pixels. Set pixels outside the run's window are clipped.
+		RLE glyphs are decoded a row at a time into the same window, one cursor per glyph.
+		Rows no glyph reaches go out together as one repeated bg transfer.
+		Anti-aliased glyphs are blended between color and bg through a ramp made once per
+		call, with bg == color only pixels at half coverage or more are drawn.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::propTextDraw(uint8_t x, uint8_t y, const char *pText, uint8_t count, uint16_t color, uint16_t bg)
+{
+	if (x >= _widthTFT || y >= _heightTFT)
+	{
+		printf("Error propTextDraw 1: Co-ordinates out of bounds\r\n");
+		return Display_CharScreenBounds;
+	}
+	// 1. Decode the characters, look up every glyph and where its origin goes, stop at one the font does not have
+	Display_Return_Codes_e errorCode = Display_Success;
+	const TFT_Glyph_t *glyphs[TFT_TEXT_RUN_MAX];
+	int16_t origins[TFT_TEXT_RUN_MAX];
+	int16_t pen = 0, inkLeft = INT16_MAX, inkRight = INT16_MIN;
+	uint8_t characters = 0, bytes = 0;
+	uint16_t previous = 0;
+	if (count > TFT_TEXT_RUN_MAX)
+		count = TFT_TEXT_RUN_MAX;
+	for (uint8_t i = 0; bytes < count; i++)
+	{
+		uint16_t code;
+		uint8_t length = utf8Decode(pText + bytes, count - bytes, code);
+		if (length == 0)
+			length = 1; // cut short, the lead byte is taken as Latin-1
+		glyphs[i] = propGlyph(code);
+		if (glyphs[i] == nullptr)
+		{
+			printf("Error propTextDraw 2: Character = U+%04X , not in font\r\n", code);
+			errorCode = Display_CharFontASCIIRange;
+			break;
+		}
+		if (i > 0)
+			pen += propKern(previous, code);
+		previous = code;
+		bytes += length;
+		characters++;
+		origins[i] = pen;
+		if (glyphs[i]->width > 0)
+		{
+			int16_t boxLeft = pen + glyphs[i]->xOffset;
+			if (boxLeft < inkLeft)
+				inkLeft = boxLeft;
+			if (boxLeft + glyphs[i]->width - 1 > inkRight)
+				inkRight = boxLeft + glyphs[i]->width - 1;
+		}
+		pen += glyphs[i]->xAdvance;
+	}
+	if (characters == 0 || pen <= 0)
+		return errorCode;
+
+	if (displayListActive())
+	{
+		int16_t args[TFT_DISPLAY_OP_ARGS_MAX] = {x, y, (int16_t)color, (int16_t)bg, bytes};
+		for (uint8_t i = 0; i < bytes; i++)
+			args[5 + i / 2] |= (uint8_t)pText[i] << ((i & 1) * 8);
+		if (bg != color)
+			displayListRecord(TFTOp_TextProp, args, 5 + (bytes + 1) / 2, _propFont, x, y, x + pen - 1, y + _propFont->height - 1, true);
+		else if (inkLeft <= inkRight)
+			displayListRecord(TFTOp_TextProp, args, 5 + (bytes + 1) / 2, _propFont, x + inkLeft, y, x + inkRight, y + _propFont->height - 1, false);
+		return errorCode;
+	}
+
+	// 2. RLE glyphs are decoded a row at a time as the rows are drawn, one cursor per glyph
+	bool rle = (_propFont->encoding == TFTGlyph_RLE);
+	RunCursor_t cursors[TFT_TEXT_RUN_MAX];
+	for (uint8_t i = 0; rle && i < characters; i++)
+		cursors[i] = {_propFont->bitmap + glyphs[i]->bitmapOffset, 0, 0};
+
+	// 3. Transparent background, one rectangle per run of set pixels in each glyph row
+	uint8_t bpp = propBitsPerPixel();
+	uint8_t levels = (1 << bpp) - 1;
+	if (bg == color)
+	{
+		uint8_t threshold = (levels + 1) / 2; // nothing to blend with, half coverage or more is set
+		for (uint8_t i = 0; i < characters; i++)
+		{
+			const TFT_Glyph_t &glyph = *glyphs[i];
+			const uint8_t *bits = _propFont->bitmap + glyph.bitmapOffset;
+			int16_t left = x + origins[i] + glyph.xOffset;
+			for (uint8_t row = 0; row < glyph.height; row++)
+			{
+				int16_t top = y + glyph.yOffset + row;
+				uint8_t spanStart, spanEnd;
+				while (rle && propRunNext(glyph, cursors[i], row, spanStart, spanEnd))
+				{
+					int16_t start = (left + spanStart < 0) ? 0 : left + spanStart;
+					int16_t end = (left + spanEnd > _widthTFT) ? _widthTFT : left + spanEnd;
+					if (top >= 0 && top < _heightTFT && start < end)
+						fillRectSolid(start, top, end - start, 1, color);
+				}
+				if (rle || top < 0 || top >= _heightTFT)
+					continue;
+				uint32_t bit = (uint32_t)row * glyph.width * bpp;
+				int16_t runStart = -1;
+				for (uint8_t column = 0; column <= glyph.width; column++, bit += bpp)
+				{
+					bool set = column < glyph.width && ((bits[bit >> 3] >> (8 - bpp - (bit & 7))) & levels) >= threshold;
+					if (set && runStart < 0)
+						runStart = column;
+					if (!set && runStart >= 0)
+					{
+						int16_t start = (left + runStart < 0) ? 0 : left + runStart;
+						int16_t end = (left + column > _widthTFT) ? _widthTFT : left + column;
+						if (start < end)
+							fillRectSolid(start, top, end - start, 1, color);
+						runStart = -1;
+					}
+				}
+			}
+		}
+		return errorCode;
+	}
+
+	// 4. Opaque, one window over the run, clipped by the screen, rows packed into the row buffers,
+	// rows no glyph reaches are background and go together as one repeated color
+	uint16_t ramp[16]; // coverage level to 565 color, bg to color
+	for (uint8_t level = 0; level <= levels; level++)
+		ramp[level] = blend565(color, bg, (level * 32 + levels / 2) / levels);
+	uint16_t w = pen;
+	uint16_t h = _propFont->height;
+	if (x + w > _widthTFT)
+		w = _widthTFT - x;
+	if (y + h > _heightTFT)
+		h = _heightTFT - y;
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	PixelStream_t stream = {nullptr, 0};
+	uint32_t blank = 0;
+	for (uint8_t row = 0; row < h; row++)
+	{
+		bool ink = false;
+		for (uint8_t i = 0; i < characters && origins[i] < w && !ink; i++)
+			ink = glyphs[i]->width > 0 && row >= glyphs[i]->yOffset && row < glyphs[i]->yOffset + glyphs[i]->height;
+		if (!ink)
+		{
+			blank += w;
+			continue;
+		}
+		pixelStreamPut(stream, bg, blank);
+		blank = 0;
+		uint16_t *lineBuffer = pixelStreamReserve(stream, w);
+		for (uint16_t column = 0; column < w; column++)
+			lineBuffer[column] = bg;
+		for (uint8_t i = 0; i < characters && origins[i] < w; i++)
+		{
+			int16_t left = origins[i] + glyphs[i]->xOffset;
+			int16_t boxRow = row - glyphs[i]->yOffset;
+			uint8_t runStart, runEnd;
+			if (!rle)
+				propExpandRow(*glyphs[i], boxRow, lineBuffer, left, w, ramp);
+			else if (boxRow >= 0 && boxRow < glyphs[i]->height)
+				while (propRunNext(*glyphs[i], cursors[i], boxRow, runStart, runEnd))
+					for (int16_t pixel = left + runStart; pixel < left + runEnd; pixel++)
+						if (pixel >= 0 && pixel < w)
+							lineBuffer[pixel] = color;
+		}
+	}
+	pixelStreamPut(stream, bg, blank);
+	pixelStreamFlush(stream);
+	return errorCode;
+}
+
+/*!
+	@brief Next run of set pixels in a row of an RLE glyph
+	@param glyph the glyph
+	@param cursor the glyph's decoder, starts at its first code byte
+	@param row row of the glyph's box, rows must be asked for top to bottom
+	@param start first column of the run in the box
+	@param end column after the run
+	@return false when the row has no more runs
+	@note Runs that go on over a code byte, longer than 15 pixels, come back as one.
+		Rows that are skipped are decoded and dropped.
+*/
+bool ST7735_TFT_graphics::propRunNext(const TFT_Glyph_t &glyph, RunCursor_t &cursor, uint8_t row, uint8_t &start, uint8_t &end)
+{
+	uint16_t rowStart = row * glyph.width;
+	uint16_t rowEnd = rowStart + glyph.width;
+	bool found = false;
+	while (cursor.index < rowEnd)
+	{
+		if (cursor.set == 0)
+		{
+			if (found && (*cursor.data >> 4) != 0)
+				break; // background follows, the run ends here
+			uint8_t code = *cursor.data++;
+			cursor.index += code >> 4;
+			cursor.set = code & 0x0F;
+			continue;
+		}
+		uint16_t runEnd = (cursor.index + cursor.set < rowEnd) ? cursor.index + cursor.set : rowEnd;
+		if (runEnd > rowStart)
+		{
+			if (!found)
+				start = ((cursor.index > rowStart) ? cursor.index : rowStart) - rowStart;
+			end = runEnd - rowStart;
+			found = true;
+		}
+		cursor.set -= runEnd - cursor.index;
+		cursor.index = runEnd;
+	}
+	return found;
+}
+
+/*!
+	@brief Add pixels of one color to the stream
+	@param stream the stream being filled
+	@param color 565 16-bit
+	@param count pixels of color to add
+	@note Short runs are copied into the row buffer, sent when it fills,
+		long ones flush it and go out as one repeated color transfer.
+*/
+void ST7735_TFT_graphics::pixelStreamPut(PixelStream_t &stream, uint16_t color, uint32_t count)
+{
+	if (count >= TFT_PIXEL_RUN_REPEAT)
+	{
+		pixelStreamFlush(stream);
+		spiWriteColorRepeatAsync(color, count);
+		return;
+	}
+	while (count > 0)
+	{
+		if (stream.buffer == nullptr)
+			stream.buffer = rowBufferNext();
+		uint16_t piece = TFT_MAX_ROW_PIXELS - stream.used;
+		piece = (count < piece) ? count : piece;
+		for (uint16_t i = 0; i < piece; i++)
+			stream.buffer[stream.used++] = color;
+		count -= piece;
+		if (stream.used == TFT_MAX_ROW_PIXELS)
+			pixelStreamFlush(stream);
+	}
+}
+
+/*!
+	@brief Make room in the stream's row buffer for pixels the caller writes itself
+	@param stream the stream being filled
+	@param count pixels, at most TFT_MAX_ROW_PIXELS
+	@return where the count pixels go, sent with the stream
+*/
+uint16_t *ST7735_TFT_graphics::pixelStreamReserve(PixelStream_t &stream, uint16_t count)
+{
+	if (stream.buffer != nullptr && stream.used + count > TFT_MAX_ROW_PIXELS)
+		pixelStreamFlush(stream);
+	if (stream.buffer == nullptr)
+		stream.buffer = rowBufferNext();
+	uint16_t *pixels = stream.buffer + stream.used;
+	stream.used += count;
+	return pixels;
+}
+
+/*!
+	@brief Send the pixels waiting in the stream's row buffer
+	@param stream the stream
+*/
+void ST7735_TFT_graphics::pixelStreamFlush(PixelStream_t &stream)
+{
+	if (stream.used > 0)
+		spiWritePixelBufferAsync(stream.buffer, stream.used);
+	stream = {nullptr, 0};
+}
+
+/*!
+	@brief Bits per pixel of the proportional font's glyph boxes
+	@return 1, 2 or 4, 1 for RLE
+*/
+uint8_t ST7735_TFT_graphics::propBitsPerPixel(void)
+{
+	switch (_propFont->encoding)
+	{
+	case TFTGlyph_Gray2:
+		return 2;
+	case TFTGlyph_Gray4:
+		return 4;
+	default:
+		return 1;
+	}
+}
+
+/*!
+	@brief Set one row of a proportional glyph's pixels in a row of the line
+	@param glyph the glyph
+	@param row row of the glyph's box, rows outside it set nothing
+	@param dest w pixels
+	@param left column of dest the box's left edge goes in, may be negative
+	@param w pixels in dest, set pixels outside are clipped
+	@param ramp 565 color of each coverage level, level 0 is left as it is
+*/
+void ST7735_TFT_graphics::propExpandRow(const TFT_Glyph_t &glyph, int16_t row, uint16_t *dest, int16_t left, uint16_t w, const uint16_t *ramp)
+{
+	if (row < 0 || row >= glyph.height)
+		return;
+	const uint8_t *bits = _propFont->bitmap + glyph.bitmapOffset;
+	uint8_t bpp = propBitsPerPixel();
+	uint8_t levels = (1 << bpp) - 1;
+	uint32_t bit = (uint32_t)row * glyph.width * bpp;
+	for (uint8_t column = 0; column < glyph.width; column++, bit += bpp)
+	{
+		int16_t pixel = left + column;
+		uint8_t level = (bits[bit >> 3] >> (8 - bpp - (bit & 7))) & levels;
+		if (pixel >= 0 && pixel < w && level != 0)
+			dest[pixel] = ramp[level];
+	}
+}
+
+/*!
+	@brief: Convert: 24-bit color to 565 16-bit color
+	@param r color red
+	@param g color green
+	@param b color blue
+	@return 16 bit color value
+	@note 3 byte to 2 byte,  Red Green Blue.
+		  RRRR RRRR GGGG GGGG BBBB BBBB => 565 color mode => RRRRR GGGGGG BBBBB
+*/
+uint16_t ST7735_TFT_graphics::Color565(uint16_t r, uint16_t g, uint16_t b)
+{
+	return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+/*!
+ * @brief pushColor
+ * @param color
+ * @note not in use currently.
+ */
+void ST7735_TFT_graphics ::pushColor(uint16_t color)
+{
+	uint8_t hi, lo;
+	hi = color >> 8;
+	lo = color;
+	if (_ramTarget.buffer != nullptr)
+	{
+		ramTargetWrite(&color, TFTRAMSource_Color, 1);
+		return;
+	}
+	TFTwaitIdle();
+	_addrWindow.pixelsWritten++;
+	TFT_DC_SetHigh;
+	TFT_CS_SetLow;
+	spiWrite(hi);
+	spiWrite(lo);
+	TFT_CS_SetHigh;
+}
+
+/*!
+	@brief : Write an SPI command to TFT
+	@param command byte to send
+*/
+void ST7735_TFT_graphics::writeCommand(uint8_t command)
+{
+	TFTwaitIdle();
+	addrWindowInvalidate();
+	TFT_DC_SetLow;
+	TFT_CS_SetLow;
+	spiWrite(command);
+	TFT_CS_SetHigh;
+}
+
+/*!
+	@brief Write an SPI data byte to device
+	@param dataByte byte to send
+*/
+void ST7735_TFT_graphics ::writeData(uint8_t dataByte)
+{
+	TFTwaitIdle();
+	TFT_DC_SetHigh;
+	TFT_CS_SetLow;
+	spiWrite(dataByte);
+	TFT_CS_SetHigh;
+}
+
+/*!
+	@brief  Write byte to SPI
+	@param spiData byte to write
+*/
+void ST7735_TFT_graphics::spiWrite(uint8_t spiData)
+{
+	spiSetFrameBits(8);
+	if (_pio != nullptr)
+	{
+		pio_sm_put_blocking(_pio, _pioSM, (uint32_t)spiData << 24);
+		pioWaitIdle();
+	}
+	else if (_hardwareSPI == false)
+	{
+		spiWriteSoftware(spiData);
+	}
+	else
+	{
+		spi_write_blocking(_pspiInterface, &spiData, 1);
+	}
+}
+
+/*!
+	@brief Write a byte to SPI using software SPI
+	@param spiData byte to send
+	@note uses _SWSPIGPIODelay to slowdown software SPI if CPU frequency too fast
+*/
+void ST7735_TFT_graphics::spiWriteSoftware(uint8_t spiData)
+{
+	uint8_t i;
+	for (i = 0; i < 8; i++)
+	{
+		TFT_SDATA_SetLow;
+		if (spiData & 0x80)
+			TFT_SDATA_SetHigh;
+		TFT_SCLK_SetHigh;
+		if (_SWSPIGPIODelay > 0)
+			TFT_MICROSEC_DELAY(_SWSPIGPIODelay);
+		spiData <<= 1;
+		TFT_SCLK_SetLow;
+		if (_SWSPIGPIODelay > 0)
+			TFT_MICROSEC_DELAY(_SWSPIGPIODelay);
+	}
+}
+
+/*!
+	@brief  Write a buffer to SPI, both Software and hardware SPI supported
+	@param spiData to send
+	@param len length of buffer
+*/
+void ST7735_TFT_graphics::spiWriteDataBuffer(uint8_t *spiData, uint32_t len)
+{
+	TFTwaitIdle();
+	_addrWindow.pixelsWritten += len / 2;
+	TFT_DC_SetHigh;
+	TFT_CS_SetLow;
+	spiWriteBytes(spiData, len);
+	TFT_CS_SetHigh;
+}
+
+/*!
+	@brief  Write bytes to SPI as one burst, caller handles CS and DC lines
+	@param spiData to send
+	@param len length of buffer
+	@note returns after the last bit has left the shifter, so DC can be toggled straight after.
+*/
+void ST7735_TFT_graphics::spiWriteBytes(const uint8_t *spiData, uint32_t len)
+{
+	spiSetFrameBits(8);
+	if (_pio != nullptr)
+	{
+		for (uint32_t i = 0; i < len; i++)
+		{
+			pio_sm_put_blocking(_pio, _pioSM, (uint32_t)spiData[i] << 24);
+		}
+		pioWaitIdle();
+	}
+	else if (_hardwareSPI == false)
+	{
+		for (uint32_t i = 0; i < len; i++)
+		{
+			spiWriteSoftware(spiData[i]);
+		}
+	}
+	else
+	{
+		spi_write_blocking(_pspiInterface, spiData, len);
+	}
+}
+
+/*!
+	@brief  Write a command byte and its parameters inside an open CS transaction
+	@param command command byte, sent with DC low
+	@param data parameter bytes sent as one burst with DC high, may be nullptr
+	@param len number of parameter bytes
+	@note caller must hold CS low, see TFTsetAddrWindow
+*/
+void ST7735_TFT_graphics::spiWriteCommandBytes(uint8_t command, const uint8_t *data, uint8_t len)
+{
+	TFT_DC_SetLow;
+	spiWrite(command);
+	if (len == 0)
+		return;
+	TFT_DC_SetHigh;
+	spiWriteBytes(data, len);
+}
+
+/*!
+	@brief  Queue a data buffer to SPI by DMA and return without waiting for it to be sent.
+	@param spiData to send, must stay valid and unchanged until the transfer completes
 	@param len length of buffer
+	@note Hardware SPI or PIO software SPI. Falls back to spiWriteDataBuffer for
+		GPIO software SPI or if no DMA channel was claimed.
+		Any following SPI access waits for the transfer first, see TFTwaitIdle.
+*/
+void ST7735_TFT_graphics::spiWriteDataBufferAsync(const uint8_t *spiData, uint32_t len)
+{
+	if (_ramTarget.buffer != nullptr)
+	{
+		ramTargetWrite(spiData, TFTRAMSource_Bytes, len / 2);
+		return;
+	}
+	if (_dmaChannel < 0)
+	{
+		spiWriteDataBuffer((uint8_t *)spiData, len);
+		return;
+	}
+	if (len == 0)
+		return;
+	TFTwaitIdle();
+	_addrWindow.pixelsWritten += len / 2;
+	spiSetFrameBits(8);
+	dmaSetReadIncrement(true);
+	TFT_DC_SetHigh;
+	TFT_CS_SetLow;
+	_dmaBusy = true;
+	_dmaSource = spiData;
+	dma_channel_transfer_from_buffer_now(_dmaChannel, spiData, len);
+}
+
+/*!
+	@brief  Queue RGB565 pixels to SPI with 16 bit frames, by DMA if available
+	@param pixels native uint16_t RGB565 pixels, must stay valid and unchanged until the transfer completes
+	@param count number of pixels
+	@note The SPI peripheral (or PIO state machine) is switched to 16 bit frames for
+		RAMWR data so no byte swapped copy is needed and half as many FIFO writes are made.
+		Commands switch back to 8 bit. GPIO software SPI sends high byte then low byte.
+*/
+void ST7735_TFT_graphics::spiWritePixelBufferAsync(const uint16_t *pixels, uint32_t count)
+{
+	if (count == 0)
+		return;
+	if (_ramTarget.buffer != nullptr)
+	{
+		ramTargetWrite(pixels, TFTRAMSource_Pixels, count);
+		return;
+	}
+	TFTwaitIdle();
+	_addrWindow.pixelsWritten += count;
+	spiSetFrameBits(16);
+	TFT_DC_SetHigh;
+	TFT_CS_SetLow;
+	if (_dmaChannel >= 0)
+	{
+		dmaSetReadIncrement(true);
+		_dmaBusy = true;
+		_dmaSource = pixels;
+		dma_channel_transfer_from_buffer_now(_dmaChannel, pixels, count);
+		return;
+	}
+	if (_pio != nullptr)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			pio_sm_put_blocking(_pio, _pioSM, (uint32_t)pixels[i] << 16);
+		}
+		pioWaitIdle();
+	}
+	else if (_hardwareSPI == false)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			spiWriteSoftware(pixels[i] >> 8);
+			spiWriteSoftware(pixels[i] & 0xFF);
+		}
+	}
+	else
+	{
+		spi_write16_blocking(_pspiInterface, pixels, count);
+	}
+	TFT_CS_SetHigh;
+}
+
+/*!
+	@brief  Queue count copies of one RGB565 color to SPI with 16 bit frames
+	@param color 565 16-bit color
+	@param count number of pixels
+	@note With DMA the read address is not incremented, the whole count is streamed
+		from _dmaFillColor in one transfer with no CPU work per row.
+		Without DMA a row buffer of the color is sent repeatedly.
+*/
+void ST7735_TFT_graphics::spiWriteColorRepeatAsync(uint16_t color, uint32_t count)
+{
+	if (count == 0)
+		return;
+	if (_ramTarget.buffer != nullptr)
+	{
+		ramTargetWrite(&color, TFTRAMSource_Color, count);
+		return;
+	}
+	if (_dmaChannel < 0)
+	{
+		uint16_t *rowBuffer = rowBufferNext();
+		uint32_t chunk = (count < TFT_MAX_ROW_PIXELS) ? count : TFT_MAX_ROW_PIXELS;
+		for (uint32_t i = 0; i < chunk; i++)
+		{
+			rowBuffer[i] = color;
+		}
+		while (count > 0)
+		{
+			chunk = (count < TFT_MAX_ROW_PIXELS) ? count : TFT_MAX_ROW_PIXELS;
+			spiWritePixelBufferAsync(rowBuffer, chunk);
+			count -= chunk;
+		}
+		return;
+	}
+	TFTwaitIdle();
+	_addrWindow.pixelsWritten += count;
+	spiSetFrameBits(16);
+	dmaSetReadIncrement(false);
+	_dmaFillColor = color;
+	TFT_DC_SetHigh;
+	TFT_CS_SetLow;
+	_dmaBusy = true;
+	_dmaSource = &_dmaFillColor;
+	dma_channel_transfer_from_buffer_now(_dmaChannel, &_dmaFillColor, count);
+}
+
+/*!
+	@brief  Turn DMA read address increment on for buffers or off for a repeated color
+	@param increment true to step through a buffer
+	@note bus must be idle, the channel config is only rewritten when it changes
+*/
+void ST7735_TFT_graphics::dmaSetReadIncrement(bool increment)
+{
+	if (_dmaReadIncrement == increment)
+		return;
+	_dmaReadIncrement = increment;
+	dma_channel_config dmaConfig = dma_get_channel_config(_dmaChannel);
+	channel_config_set_read_increment(&dmaConfig, increment);
+	dma_channel_set_config(_dmaChannel, &dmaConfig, false);
+}
+
+/*!
+	@brief  Set the bits per SPI frame, and the DMA transfer size to match
+	@param bits 8 for commands and byte data, 16 for RGB565 pixel data
+	@note Bus must be idle. Hardware SPI changes the frame format, PIO changes the
+		autopull threshold and restarts the state machine so the OSR starts empty.
+*/
+void ST7735_TFT_graphics::spiSetFrameBits(uint8_t bits)
+{
+	if (_spiFrameBits == bits || (_hardwareSPI == false && _pio == nullptr))
+		return;
+	_spiFrameBits = bits;
+	if (_pio != nullptr)
+	{
+		pio_sm_set_enabled(_pio, _pioSM, false);
+		hw_write_masked(&_pio->sm[_pioSM].shiftctrl, (uint32_t)(bits & 0x1f) << PIO_SM0_SHIFTCTRL_PULL_THRESH_LSB, PIO_SM0_SHIFTCTRL_PULL_THRESH_BITS);
+		pio_sm_restart(_pio, _pioSM);
+		pio_sm_set_enabled(_pio, _pioSM, true);
+	}
+	else
+	{
+		spi_set_format(_pspiInterface, bits, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+	}
+	if (_dmaChannel >= 0)
+	{
+		dma_channel_config dmaConfig = dma_get_channel_config(_dmaChannel);
+		channel_config_set_transfer_data_size(&dmaConfig, bits == 16 ? DMA_SIZE_16 : DMA_SIZE_8);
+		dma_channel_set_config(_dmaChannel, &dmaConfig, false);
+	}
+}
+
+/*!
+	@brief Wait for any queued DMA transfer to finish shifting out, then release CS.
+	@note Called internally before every SPI access, user only needs it before
+		modifying a buffer passed to a DMA transfer or before sleeping.
+*/
+void ST7735_TFT_graphics::TFTwaitIdle(void)
+{
+	if (_dmaBusy == false)
+		return;
+	dma_channel_wait_for_finish_blocking(_dmaChannel);
+	if (_pio != nullptr)
+	{
+		pioWaitIdle();
+	}
+	else
+	{
+		// DMA done means the FIFO was fed, wait for the last frame to leave the shifter
+		while (spi_is_busy(_pspiInterface))
+			tight_loop_contents();
+		// Discard the RX data that was clocked in during the transfer and clear overrun
+		while (spi_is_readable(_pspiInterface))
+			(void)spi_get_hw(_pspiInterface)->dr;
+		spi_get_hw(_pspiInterface)->icr = SPI_SSPICR_RORIC_BITS;
+	}
+	TFT_CS_SetHigh;
+	_dmaBusy = false;
+}
+
+/*!
+	@brief Wait until the PIO SPI state machine has shifted out its last bit
+	@note The state machine stalls on an empty TX FIFO with SCLK low, the sticky
+		TXSTALL flag is cleared then polled.
+*/
+void ST7735_TFT_graphics::pioWaitIdle(void)
+{
+	uint32_t stallMask = 1u << (PIO_FDEBUG_TXSTALL_LSB + _pioSM);
+	_pio->fdebug = stallMask;
+	while ((_pio->fdebug & stallMask) == 0)
+		tight_loop_contents();
+}
+
+/*!
+	@brief Set a function to be called from interrupt each time a DMA transfer completes
+	@param callback user function, nullptr to disable the interrupt
+	@note Called when the last byte is fed to the SPI FIFO, CS is still low at this point.
+		Uses a shared handler on DMA_IRQ_0. Hardware SPI or PIO software SPI with DMA only.
+*/
+void ST7735_TFT_graphics::TFTsetDMACallback(void (*callback)(void))
+{
+	_dmaCallback = callback;
+	if (_dmaChannel < 0)
+		return;
+	static bool handlerAdded = false;
+	if (handlerAdded == false)
+	{
+		irq_add_shared_handler(DMA_IRQ_0, DMAIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+		irq_set_enabled(DMA_IRQ_0, true);
+		handlerAdded = true;
+	}
+	DMACallbacks[_dmaChannel] = callback;
+	dma_channel_set_irq0_enabled(_dmaChannel, callback != nullptr);
+}
+
+/*!
+	@brief Hand out the next of the two ping-pong row buffers
+	@return pointer to a buffer of TFT_MAX_ROW_PIXELS RGB565 pixels not currently on the wire
+	@note Only one DMA transfer is ever in flight, so alternating buffers lets the
+		next row be built while the current one is sent. Waits if the buffer
+		handed out is somehow still the one being sent.
+*/
+uint16_t *ST7735_TFT_graphics::rowBufferNext(void)
+{
+	_rowBufferIndex ^= 1;
+	if (_dmaBusy && _dmaSource == _rowBuffer[_rowBufferIndex])
+		TFTwaitIdle();
+	return _rowBuffer[_rowBufferIndex];
+}
+
+/*!
+	@brief Draw into a RAM framebuffer instead of straight to the panel
+	@param buffer user array of at least screen width * height RGB565 pixels, 128x160 = 40KB
+	@param sizePixels size of buffer in pixels
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+		-# Display_BufferSize=buffer smaller than the screen
+	@note All TFTdraw and TFTfill methods then render into buffer, TFTflush() sends the
+		rectangles changed since the last flush. The buffer is not cleared, e.g. call
+		TFTfillScreen first. TFTsetRotation flushes, the buffer layout then follows the
+		new width and height so redraw the whole screen after a rotation.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetFrameBuffer(uint16_t *buffer, uint32_t sizePixels)
+{
+	if (buffer == nullptr)
+	{
+		printf("Error TFTsetFrameBuffer 1: Buffer is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	if (sizePixels < (uint32_t)_widthTFT * _heightTFT)
+	{
+		printf("Error TFTsetFrameBuffer 2: Buffer size %lu is less than screen %u x %u\r\n", (unsigned long)sizePixels, _widthTFT, _heightTFT);
+		return Display_BufferSize;
+	}
+	TFTframeBufferOff();
+	_frameBuffer = buffer;
+	_frameBufferBits = 16;
+	_ramTarget = {buffer, 0, 0, (uint8_t)_widthTFT, (uint8_t)_heightTFT, 16};
+	_fbWindow.valid = false;
+	_dirtyRectCount = 0;
+	_ramMode = TFTRAM_FrameBuffer;
+	return Display_Success;
+}
+
+/*!
+	@brief Draw into a RAM framebuffer of palette indices, expanded to RGB565 on flush
+	@param buffer user array of at least screen width * height * bitsPerPixel / 8 bytes,
+		128x160 = 20KB at 8 bits, 10KB at 4 bits, 5KB at 2 bits
+	@param sizeBytes size of buffer in bytes
+	@param bitsPerPixel 8, 4 or 2, the palette has 256, 16 or 4 entries
+	@param palette user array of 1 << bitsPerPixel RGB565 colors, see TFTsetPalette
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+		-# Display_BufferSize=buffer smaller than the screen or bits not 8, 4 or 2
+	@note Works as TFTsetFrameBuffer. Each color drawn is stored as the index of the
+		palette entry equal to it, or the nearest one if none is.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetFrameBufferIndexed(uint8_t *buffer, uint32_t sizeBytes, uint8_t bitsPerPixel, const uint16_t *palette)
+{
+	if (buffer == nullptr || palette == nullptr)
+	{
+		printf("Error TFTsetFrameBufferIndexed 1: Buffer or palette is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	if (bitsPerPixel != 8 && bitsPerPixel != 4 && bitsPerPixel != 2)
+	{
+		printf("Error TFTsetFrameBufferIndexed 2: Bits per pixel must be 8, 4 or 2 : %u\r\n", bitsPerPixel);
+		return Display_BufferSize;
+	}
+	if (sizeBytes < (uint32_t)_widthTFT * _heightTFT * bitsPerPixel / 8)
+	{
+		printf("Error TFTsetFrameBufferIndexed 3: Buffer size %lu is less than screen %u x %u\r\n", (unsigned long)sizeBytes, _widthTFT, _heightTFT);
+		return Display_BufferSize;
+	}
+	TFTframeBufferOff();
+	_frameBuffer = buffer;
+	_frameBufferBits = bitsPerPixel;
+	TFTsetPalette(palette);
+	_ramTarget = {buffer, 0, 0, (uint8_t)_widthTFT, (uint8_t)_heightTFT, bitsPerPixel};
+	_fbWindow.valid = false;
+	_dirtyRectCount = 0;
+	_ramMode = TFTRAM_FrameBuffer;
+	return Display_Success;
+}
+
+/*!
+	@brief Set the palette of the indexed framebuffer
+	@param palette user array of 1 << bitsPerPixel RGB565 colors, kept by pointer
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+	@note The whole screen is resent on the next TFTflush() in the new colors, no redraw
+		needed. For palette cycling change entries of the array and call this again.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetPalette(const uint16_t *palette)
+{
+	if (palette == nullptr)
+	{
+		printf("Error TFTsetPalette 1: Palette is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	_palette = palette;
+	_paletteLastColor = palette[0];
+	_paletteLastIndex = 0;
+	if (_ramMode == TFTRAM_FrameBuffer && _frameBufferBits < 16)
+	{
+		_shadowValid = false; // same indices, new colors
+		frameBufferMarkDirty(0, 0, _widthTFT - 1, _heightTFT - 1);
+	}
+	return Display_Success;
+}
+
+/*!
+	@brief Record draw calls and re-rasterize only the changed tiles of the screen on flush
+	@param tileCache user array of tileCount * tileWidth * tileHeight RGB565 pixels
+	@param tileCount number of tiles held in RAM, 1 to TFT_TILE_CACHE_MAX
+	@param tileWidth tile width in pixels, at least TFT_TILE_MIN_SIZE
+	@param tileHeight tile height in pixels, at least TFT_TILE_MIN_SIZE
+	@param displayList user array the draw calls are recorded in
+	@param displayListSize size of displayList in bytes, 8 to 20 bytes per draw call
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+		-# Display_BufferSize=tile count or size out of range
+	@note For when a 40KB framebuffer will not fit, e.g. 4 tiles of 16x16 = 2KB plus the list.
+		Draw calls are recorded, not drawn, and mark the tiles they touch dirty. TFTflush()
+		renders each dirty tile by replaying the calls that touch it, a tile still in
+		the cache only needs sending. Flush cost scales with the changed area.
+		A call that paints a solid rectangle (fill, bitmap, text with a background) drops the
+		calls it hides from the list, so TFTfillScreen starts a new list. Bitmap data is
+		read again on flush, keep it unchanged while in the list.
+		Pixels no call has covered are black. A call that does not fit in the list is
+		drawn straight to the panel, TFTflush() then returns Display_DisplayListFull.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetTileMode(uint16_t *tileCache, uint8_t tileCount, uint8_t tileWidth, uint8_t tileHeight, uint8_t *displayList, uint16_t displayListSize)
+{
+	if (tileCache == nullptr || displayList == nullptr)
+	{
+		printf("Error TFTsetTileMode 1: Buffer is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	if (tileCount == 0 || tileCount > TFT_TILE_CACHE_MAX || tileWidth < TFT_TILE_MIN_SIZE ||
+		tileHeight < TFT_TILE_MIN_SIZE || displayListSize < sizeof(DisplayOp_t))
+	{
+		printf("Error TFTsetTileMode 2: Tile count 1-%u, tile size >= %u\r\n", TFT_TILE_CACHE_MAX, TFT_TILE_MIN_SIZE);
+		return Display_BufferSize;
+	}
+	TFTframeBufferOff();
+	_tileCache = tileCache;
+	_tileCount = tileCount;
+	_tileWidth = tileWidth;
+	_tileHeight = tileHeight;
+	for (uint8_t slot = 0; slot < tileCount; slot++)
+		_tileSlots[slot] = {-1, 0};
+	memset(_dirtyTiles, 0, sizeof(_dirtyTiles));
+	_displayList = displayList;
+	_displayListSize = displayListSize;
+	_displayListUsed = 0;
+	_displayListOverflow = false;
+	_ramMode = TFTRAM_Tiles;
+	return Display_Success;
+}
+
+/*!
+	@brief Record draw calls and rasterize the changed rows of the screen band by band on flush
+	@param bandBuffer user array of bandCount * TFT_MAX_ROW_PIXELS * bandRows RGB565 pixels
+	@param bandCount number of band buffers, 1, or 2 so one band renders while DMA sends the other
+	@param bandRows rows per band, at least TFT_TILE_MIN_SIZE, e.g. 16 rows x 2 bands = 10KB
+	@param displayList user array the draw calls are recorded in
+	@param displayListSize size of displayList in bytes
+	@return as TFTsetTileMode
+	@note Tile mode with full width tiles, so each band is sent with one address window.
+		Band width is TFT_MAX_ROW_PIXELS so the buffer also fits after a rotation.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetBandMode(uint16_t *bandBuffer, uint8_t bandCount, uint8_t bandRows, uint8_t *displayList, uint16_t displayListSize)
+{
+	if (bandCount > 2)
+	{
+		printf("Error TFTsetBandMode 1: Band count 1 or 2\r\n");
+		return Display_BufferSize;
+	}
+	return TFTsetTileMode(bandBuffer, bandCount, TFT_MAX_ROW_PIXELS, bandRows, displayList, displayListSize);
+}
+
+/*!
+	@brief Flush the framebuffer or tiles and return to drawing straight to the panel
+*/
+void ST7735_TFT_graphics::TFTframeBufferOff(void)
+{
+	TFTflush();
+	TFTwaitIdle();
+	_ramMode = TFTRAM_Direct;
+	_ramTarget.buffer = nullptr;
+	_frameBuffer = nullptr;
+	_frameBufferBits = 16;
+	_palette = nullptr;
+	_shadowBuffer = nullptr;
+	_shadowValid = false;
+	_tileCache = nullptr;
+	_tileCount = 0;
+	_displayList = nullptr;
+	_displayListUsed = 0;
+}
+
+/*!
+	@brief Send what has changed since the last flush to the panel
+	@return
+		-# Display_Success
+		-# Display_DisplayListFull=tile mode, a draw call did not fit in the display list.
+			It was drawn straight to the panel, but a tile re-rendered from the list loses it.
+			Reported until an opaque call, e.g. TFTfillScreen, covers it. Use a bigger list.
+	@note Framebuffer mode sends the dirty rectangles, tile mode the dirty tiles.
+		With DMA the last transfer is still in flight on return, drawing into the
+		buffer it reads from waits for it.
+*/
+Display_Return_Codes_e ST7735_TFT_graphics::TFTflush(void)
+{
+	switch (_ramMode)
+	{
+	case TFTRAM_FrameBuffer:
+		frameBufferFlush();
+		break;
+	case TFTRAM_Tiles:
+		tileFlush();
+		if (_displayListOverflow)
+			return Display_DisplayListFull;
+		break;
+	default:
+		break;
+	}
+	return Display_Success;
+}
+
+/*!
+	@brief Send the dirty rectangles of the framebuffer to the panel
+	@note A full width rectangle is one window and one transfer. Otherwise one
+		transfer per row, the rows are sequential so only the first needs a window.
+		An indexed framebuffer is expanded through the palette a row at a time into
+		the ping-pong row buffers, so one row is expanded while the last is sent.
+*/
+void ST7735_TFT_graphics::frameBufferFlush(void)
+{
+	_ramTarget.buffer = nullptr; // window and pixel writes below go to the panel
+	_flushBytesSaved = 0;
+	const uint16_t *frameBuffer = (const uint16_t *)_frameBuffer;
+	for (uint8_t i = 0; i < _dirtyRectCount; i++)
+	{
+		const DirtyRect_t &rect = _dirtyRects[i];
+		uint8_t w = rect.x1 - rect.x0 + 1;
+		if (_shadowValid)
+		{
+			shadowDiffRect(rect);
+			continue;
+		}
+		if (_frameBufferBits < 16)
+		{
+			TFTsetAddrWindow(rect.x0, rect.y0, rect.x1, rect.y1);
+			for (uint8_t y = rect.y0; y <= rect.y1; y++)
+			{
+				uint16_t *rowBuffer = rowBufferNext();
+				paletteExpand(rowBuffer, (uint32_t)y * _widthTFT + rect.x0, w);
+				spiWritePixelBufferAsync(rowBuffer, w);
+			}
+			continue;
+		}
+		if (w == _widthTFT)
+		{
+			TFTsetAddrWindow(0, rect.y0, rect.x1, rect.y1);
+			spiWritePixelBufferAsync(frameBuffer + (uint32_t)rect.y0 * _widthTFT, (uint32_t)w * (rect.y1 - rect.y0 + 1));
+			continue;
+		}
+		for (uint8_t y = rect.y0; y <= rect.y1; y++)
+		{
+			TFTsetAddrWindow(rect.x0, y, rect.x1, y);
+			spiWritePixelBufferAsync(frameBuffer + (uint32_t)y * _widthTFT + rect.x0, w);
+		}
+	}
+	if (_shadowBuffer != nullptr)
+		shadowUpdate();
+	_dirtyRectCount = 0;
+	_ramTarget.buffer = _frameBuffer;
+}
+
+/*!
+	@brief Keep a copy of what the panel shows, so TFTflush() sends only changed pixels
+	@param shadow user array the same size as the framebuffer
+	@param sizeBytes size of shadow in bytes
+	@param mergeGap changed spans on a row this many unchanged pixels apart or closer
+		are sent as one, TFT_SHADOW_MERGE_GAP (3) is where resending the gap costs as
+		much as a new address window
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+		-# Display_BufferSize=shadow smaller than the framebuffer
+		-# Display_GenericError=no framebuffer set
+	@note Call after TFTsetFrameBuffer or TFTsetFrameBufferIndexed. Each dirty rectangle
+		is then compared row by row with the shadow and only the changed spans are sent,
+		each with its own address window. The next flush sends the whole screen to
+		start the shadow. For mostly static screens, gauges and clocks.
+		TFTframeBufferOff turns it off. See TFTflushBytesSaved to tune mergeGap.
 */
-void ST7735_TFT_graphics::spiWriteDataBuffer(uint8_t *spiData, uint32_t len)
+Display_Return_Codes_e ST7735_TFT_graphics::TFTsetShadowBuffer(void *shadow, uint32_t sizeBytes, uint8_t mergeGap)
 {
-	TFT_DC_SetHigh;
-	TFT_CS_SetLow;
-	if (_hardwareSPI == false)
+	if (shadow == nullptr)
 	{
-		for (uint32_t i = 0; i < len; i++)
+		printf("Error TFTsetShadowBuffer 1: Buffer is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	if (_ramMode != TFTRAM_FrameBuffer)
+	{
+		printf("Error TFTsetShadowBuffer 2: Set a framebuffer first\r\n");
+		return Display_GenericError;
+	}
+	if (sizeBytes < (uint32_t)_widthTFT * _heightTFT * _frameBufferBits / 8)
+	{
+		printf("Error TFTsetShadowBuffer 3: Buffer size %lu is less than the framebuffer\r\n", (unsigned long)sizeBytes);
+		return Display_BufferSize;
+	}
+	_shadowBuffer = shadow;
+	_shadowMergeGap = mergeGap;
+	_shadowValid = false;
+	frameBufferMarkDirty(0, 0, _widthTFT - 1, _heightTFT - 1);
+	return Display_Success;
+}
+
+/*!
+	@brief Bytes the last TFTflush() did not send thanks to the shadow buffer
+	@return pixel bytes skipped less the extra address window bytes, negative if
+		mergeGap is set too low
+	@note Compared with sending every dirty rectangle whole, one window per row.
+*/
+int32_t ST7735_TFT_graphics::TFTflushBytesSaved(void)
+{
+	return _flushBytesSaved;
+}
+
+/*!
+	@brief Read one pixel of the framebuffer or shadow
+	@param buffer _frameBuffer or _shadowBuffer
+	@param offset pixel offset
+	@return RGB565 color, or palette index for an indexed framebuffer
+*/
+uint16_t ST7735_TFT_graphics::frameBufferPixel(const void *buffer, uint32_t offset)
+{
+	uint8_t bits = _frameBufferBits;
+	if (bits == 16)
+		return ((const uint16_t *)buffer)[offset];
+	uint32_t bit = offset * bits;
+	return (((const uint8_t *)buffer)[bit / 8] >> (8 - bits - (bit & 7))) & ((1 << bits) - 1);
+}
+
+/*!
+	@brief Send the pixels of a dirty rectangle that differ from the shadow
+	@param rect dirty rectangle
+	@note Per row, changed spans closer than _shadowMergeGap are joined. Each span is
+		one address window, the window cache makes that CASET and RAMWR only on one row.
+*/
+void ST7735_TFT_graphics::shadowDiffRect(const DirtyRect_t &rect)
+{
+	// New window: CASET + 4 bytes + RAMWR, RASET is skipped by the window cache on the same row
+	const int32_t windowBytes = 6;
+	for (uint8_t y = rect.y0; y <= rect.y1; y++)
+	{
+		uint32_t rowOffset = (uint32_t)y * _widthTFT;
+		int16_t spanStart = -1;
+		uint8_t lastChanged = 0;
+		uint8_t spans = 0;
+		uint32_t sent = 0;
+		for (uint16_t x = rect.x0; x <= rect.x1 + 1; x++)
 		{
-			spiWriteSoftware(spiData[i]);
+			bool changed = x <= rect.x1 &&
+				frameBufferPixel(_frameBuffer, rowOffset + x) != frameBufferPixel(_shadowBuffer, rowOffset + x);
+			// Close the open span at the end of the row or when the gap is too wide to merge
+			if (spanStart >= 0 && (x > rect.x1 || (changed && x - lastChanged - 1 > _shadowMergeGap)))
+			{
+				frameBufferSendSpan(spanStart, lastChanged, y);
+				sent += lastChanged - spanStart + 1;
+				spans++;
+				spanStart = -1;
+			}
+			if (changed)
+			{
+				if (spanStart < 0)
+					spanStart = x;
+				lastChanged = x;
+			}
 		}
+		_flushBytesSaved += (int32_t)(rect.x1 - rect.x0 + 1 - sent) * 2;
+		if (spans == 0)
+			_flushBytesSaved += windowBytes;
+		else
+			_flushBytesSaved -= (spans - 1) * windowBytes;
 	}
-	else
+}
+
+/*!
+	@brief Send one row span of the framebuffer to the panel
+	@param x0 left column
+	@param x1 right column
+	@param y row
+*/
+void ST7735_TFT_graphics::frameBufferSendSpan(uint8_t x0, uint8_t x1, uint8_t y)
+{
+	uint32_t offset = (uint32_t)y * _widthTFT + x0;
+	uint8_t w = x1 - x0 + 1;
+	TFTsetAddrWindow(x0, y, x1, y);
+	if (_frameBufferBits == 16)
 	{
-		spi_write_blocking(_pspiInterface, spiData, len);
+		spiWritePixelBufferAsync((const uint16_t *)_frameBuffer + offset, w);
+		return;
 	}
-	TFT_CS_SetHigh;
+	uint16_t *rowBuffer = rowBufferNext();
+	paletteExpand(rowBuffer, offset, w);
+	spiWritePixelBufferAsync(rowBuffer, w);
+}
+
+/*!
+	@brief Copy the flushed dirty rectangles into the shadow, the whole framebuffer the first time
+	@note Outside the dirty rectangles framebuffer and shadow are already equal, so the
+		bytes shared with neighbouring pixels of an indexed row can be copied as well.
+*/
+void ST7735_TFT_graphics::shadowUpdate(void)
+{
+	uint8_t bits = _frameBufferBits;
+	if (_shadowValid == false)
+	{
+		memcpy(_shadowBuffer, _frameBuffer, (uint32_t)_widthTFT * _heightTFT * bits / 8);
+		_shadowValid = true;
+		return;
+	}
+	for (uint8_t i = 0; i < _dirtyRectCount; i++)
+	{
+		const DirtyRect_t &rect = _dirtyRects[i];
+		for (uint8_t y = rect.y0; y <= rect.y1; y++)
+		{
+			uint32_t first = ((uint32_t)y * _widthTFT + rect.x0) * bits / 8;
+			uint32_t last = (((uint32_t)y * _widthTFT + rect.x1 + 1) * bits + 7) / 8;
+			memcpy((uint8_t *)_shadowBuffer + first, (const uint8_t *)_frameBuffer + first, last - first);
+		}
+	}
+}
+
+/*!
+	@brief Render and send every dirty tile, one window and one transfer per tile
+	@note A tile in the cache is already up to date. Otherwise the least recently
+		used buffer is cleared and the display list replayed into it. With DMA the
+		next tile is rendered while the last is sent if there are two or more buffers.
+*/
+void ST7735_TFT_graphics::tileFlush(void)
+{
+	uint8_t columns = (_widthTFT + _tileWidth - 1) / _tileWidth;
+	uint8_t rows = (_heightTFT + _tileHeight - 1) / _tileHeight;
+	for (uint16_t tile = 0; tile < columns * rows; tile++)
+	{
+		uint32_t bit = 1u << (tile % 32);
+		if ((_dirtyTiles[tile / 32] & bit) == 0)
+			continue;
+		_dirtyTiles[tile / 32] &= ~bit;
+
+		// 1. Find the tile in the cache, else take an empty or the least recently used buffer
+		uint8_t slot = 0;
+		bool cached = false;
+		for (uint8_t i = 0; i < _tileCount; i++)
+		{
+			if (_tileSlots[i].tile == tile)
+			{
+				slot = i;
+				cached = true;
+				break;
+			}
+			if (_tileSlots[i].lastUse < _tileSlots[slot].lastUse)
+				slot = i;
+		}
+		_tileSlots[slot].lastUse = ++_tileClock;
+		if (cached == false)
+			_tileSlots[slot].tile = tile;
+		tileTarget(slot);
+		// 2. Re-rasterize from the display list
+		if (cached == false)
+		{
+			ramTargetWaitIdle();
+			memset(_ramTarget.buffer, 0, (uint32_t)_ramTarget.w * _ramTarget.h * sizeof(uint16_t));
+			displayListRender(0);
+		}
+		// 3. Send it
+		RamTarget_t target = _ramTarget;
+		_ramTarget.buffer = nullptr;
+		TFTsetAddrWindow(target.x, target.y, target.x + target.w - 1, target.y + target.h - 1);
+		spiWritePixelBufferAsync((const uint16_t *)target.buffer, (uint32_t)target.w * target.h);
+	}
+}
+
+/*!
+	@brief Make a tile cache buffer the RAM target
+	@param slot index in _tileSlots, its tile must be set
+	@note Edge tiles are clipped to the screen, the buffer stride is the clipped width.
+*/
+void ST7735_TFT_graphics::tileTarget(uint8_t slot)
+{
+	uint8_t columns = (_widthTFT + _tileWidth - 1) / _tileWidth;
+	uint16_t tile = _tileSlots[slot].tile;
+	uint8_t x = (tile % columns) * _tileWidth;
+	uint8_t y = (tile / columns) * _tileHeight;
+	uint8_t w = (_widthTFT - x < _tileWidth) ? _widthTFT - x : _tileWidth;
+	uint8_t h = (_heightTFT - y < _tileHeight) ? _heightTFT - y : _tileHeight;
+	_ramTarget = {_tileCache + (uint32_t)slot * _tileWidth * _tileHeight, x, y, w, h, 16};
+	_fbWindow.valid = false;
+}
+
+/*!
+	@brief Claim the next run of pixels in the RAM window, advancing the write position
+	@param count in: pixels wanted, out: pixels in the run, never past the end of the
+		window row or across the RAM target edge
+	@param offset out: pixel offset of the run in the RAM target
+	@return true if the run is inside the RAM target, false if it is skipped
+	@note Wraps to the top of the window after the last row, like the panel's RAM pointer.
+*/
+bool ST7735_TFT_graphics::ramTargetRun(uint32_t &count, uint32_t &offset)
+{
+	if (_fbWindow.valid == false)
+		return false;
+	const RamTarget_t &target = _ramTarget;
+	uint8_t x = _fbWindow.x;
+	uint8_t y = _fbWindow.y;
+	bool inside = false;
+	uint32_t room = _fbWindow.x1 - x + 1;
+	if (count > room)
+		count = room;
+	if (y >= target.y && y < target.y + target.h)
+	{
+		if (x < target.x)
+		{
+			if (count > (uint32_t)(target.x - x))
+				count = target.x - x;
+		}
+		else if (x < target.x + target.w)
+		{
+			if (count > (uint32_t)(target.x + target.w - x))
+				count = target.x + target.w - x;
+			ramTargetWaitIdle();
+			offset = (uint32_t)(y - target.y) * target.w + (x - target.x);
+			inside = true;
+		}
+	}
+	_fbWindow.x += count;
+	if (_fbWindow.x > _fbWindow.x1)
+	{
+		_fbWindow.x = _fbWindow.x0;
+		_fbWindow.y = (_fbWindow.y == _fbWindow.y1) ? _fbWindow.y0 : _fbWindow.y + 1;
+	}
+	return inside;
+}
+
+/*!
+	@brief Write a stream of pixels to the RAM window, the RAM side of the pixel sinks
+	@param source pixels, big endian bytes or one color, see kind
+	@param kind what source points at
+	@param count number of pixels
+	@note Pixels outside the RAM target are skipped, the stream still advances.
+*/
+void ST7735_TFT_graphics::ramTargetWrite(const void *source, TFT_RAM_source_e kind, uint32_t count)
+{
+	const uint16_t *pixels = (const uint16_t *)source;
+	const uint8_t *bytes = (const uint8_t *)source;
+	uint16_t color = (kind == TFTRAMSource_Color) ? *pixels : 0;
+	while (count > 0)
+	{
+		uint32_t run = count;
+		uint32_t offset = 0;
+		if (ramTargetRun(run, offset))
+		{
+			uint16_t *span = (uint16_t *)_ramTarget.buffer;
+			if (_ramTarget.bits < 16)
+			{
+				for (uint32_t i = 0; i < run; i++)
+				{
+					if (kind == TFTRAMSource_Pixels)
+						color = pixels[i];
+					else if (kind == TFTRAMSource_Bytes)
+						color = (bytes[2 * i] << 8) | bytes[2 * i + 1];
+					ramTargetPut(offset + i, color);
+				}
+			}
+			else if (kind == TFTRAMSource_Pixels)
+			{
+				memcpy(span + offset, pixels, run * sizeof(uint16_t));
+			}
+			else
+			{
+				for (uint32_t i = 0; i < run; i++)
+					span[offset + i] = (kind == TFTRAMSource_Bytes) ? (bytes[2 * i] << 8) | bytes[2 * i + 1] : color;
+			}
+		}
+		if (kind == TFTRAMSource_Pixels)
+			pixels += run;
+		else if (kind == TFTRAMSource_Bytes)
+			bytes += 2 * run;
+		count -= run;
+	}
+}
+
+/*!
+	@brief Store one pixel in the RAM target
+	@param offset pixel offset in the RAM target
+	@param color 565 16-bit, stored as a palette index in an indexed framebuffer
+	@note Indexed pixels are packed most significant bits first.
+*/
+void ST7735_TFT_graphics::ramTargetPut(uint32_t offset, uint16_t color)
+{
+	uint8_t bits = _ramTarget.bits;
+	if (bits == 16)
+	{
+		((uint16_t *)_ramTarget.buffer)[offset] = color;
+		return;
+	}
+	uint32_t bit = offset * bits;
+	uint8_t *pixelByte = (uint8_t *)_ramTarget.buffer + bit / 8;
+	uint8_t shift = 8 - bits - (bit & 7);
+	uint8_t mask = ((1 << bits) - 1) << shift;
+	*pixelByte = (*pixelByte & ~mask) | ((paletteIndex(color) << shift) & mask);
+}
+
+/*!
+	@brief Read one pixel of the RAM target
+	@param offset pixel offset in the target
+	@return RGB565 color, palette entry for an indexed framebuffer
+*/
+uint16_t ST7735_TFT_graphics::ramTargetGet(uint32_t offset)
+{
+	uint8_t bits = _ramTarget.bits;
+	if (bits == 16)
+		return ((const uint16_t *)_ramTarget.buffer)[offset];
+	uint32_t bit = offset * bits;
+	uint8_t index = (((const uint8_t *)_ramTarget.buffer)[bit / 8] >> (8 - bits - (bit & 7))) & ((1 << bits) - 1);
+	return _palette[index];
+}
+
+/*!
+	@brief Palette index for a color, the equal entry or else the nearest
+	@param color 565 16-bit
+	@return index into _palette
+	@note The last lookup is cached, drawing is mostly runs of one color.
+*/
+uint8_t ST7735_TFT_graphics::paletteIndex(uint16_t color)
+{
+	if (color == _paletteLastColor)
+		return _paletteLastIndex;
+	uint16_t entries = 1 << _frameBufferBits;
+	uint8_t best = 0;
+	uint32_t bestDistance = UINT32_MAX;
+	for (uint16_t i = 0; i < entries; i++)
+	{
+		uint16_t entry = _palette[i];
+		if (entry == color)
+		{
+			best = i;
+			break;
+		}
+		// 5 bit red and blue are doubled to weigh the same as 6 bit green
+		int32_t red = ((entry >> 11) - (color >> 11)) * 2;
+		int32_t green = ((entry >> 5) & 0x3F) - ((color >> 5) & 0x3F);
+		int32_t blue = ((entry & 0x1F) - (color & 0x1F)) * 2;
+		uint32_t distance = red * red + green * green + blue * blue;
+		if (distance < bestDistance)
+		{
+			bestDistance = distance;
+			best = i;
+		}
+	}
+	_paletteLastColor = color;
+	_paletteLastIndex = best;
+	return best;
+}
+
+/*!
+	@brief Expand palette indices of the indexed framebuffer to RGB565
+	@param row destination, count pixels
+	@param offset pixel offset in the framebuffer
+	@param count number of pixels
+*/
+void ST7735_TFT_graphics::paletteExpand(uint16_t *row, uint32_t offset, uint8_t count)
+{
+	const uint8_t *frameBuffer = (const uint8_t *)_frameBuffer;
+	uint8_t bits = _frameBufferBits;
+	uint8_t mask = (1 << bits) - 1;
+	uint32_t bit = offset * bits;
+	for (uint8_t i = 0; i < count; i++, bit += bits)
+		row[i] = _palette[(frameBuffer[bit / 8] >> (8 - bits - (bit & 7))) & mask];
+}
+
+/*!
+	@brief Wait for a DMA transfer still reading from the RAM target before it is written
+*/
+void ST7735_TFT_graphics::ramTargetWaitIdle(void)
+{
+	if (_dmaBusy == false)
+		return;
+	uintptr_t source = (uintptr_t)_dmaSource;
+	uintptr_t start = (uintptr_t)_ramTarget.buffer;
+	if (source >= start && source < start + (uint32_t)_ramTarget.w * _ramTarget.h * _ramTarget.bits / 8)
+		TFTwaitIdle();
+}
+
+/*!
+	@brief Add a rectangle to the dirty list of the framebuffer
+	@param x0 left column
+	@param y0 top row
+	@param x1 right column
+	@param y1 bottom row
+	@note Rectangles that overlap or touch are merged into their bounding box. When the
+		list is full the existing rectangle that grows least is merged in.
+*/
+void ST7735_TFT_graphics::frameBufferMarkDirty(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+	DirtyRect_t rect = {x0, y0, x1, y1};
+	bool merged = true;
+	while (merged)
+	{
+		merged = false;
+		int8_t best = -1;
+		uint32_t bestGrowth = UINT32_MAX;
+		for (uint8_t i = 0; i < _dirtyRectCount; i++)
+		{
+			const DirtyRect_t &r = _dirtyRects[i];
+			uint8_t ux0 = (r.x0 < rect.x0) ? r.x0 : rect.x0;
+			uint8_t uy0 = (r.y0 < rect.y0) ? r.y0 : rect.y0;
+			uint8_t ux1 = (r.x1 > rect.x1) ? r.x1 : rect.x1;
+			uint8_t uy1 = (r.y1 > rect.y1) ? r.y1 : rect.y1;
+			bool touching = rect.x0 <= r.x1 + 1 && r.x0 <= rect.x1 + 1 && rect.y0 <= r.y1 + 1 && r.y0 <= rect.y1 + 1;
+			uint32_t growth = (uint32_t)(ux1 - ux0 + 1) * (uy1 - uy0 + 1) - (uint32_t)(r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+			if (touching)
+				growth = 0;
+			if (growth < bestGrowth)
+			{
+				best = i;
+				bestGrowth = growth;
+			}
+		}
+		// Merge when touching, or when the list is full merge the cheapest
+		if (best >= 0 && (bestGrowth == 0 || _dirtyRectCount == TFT_DIRTY_RECTS_MAX))
+		{
+			const DirtyRect_t &r = _dirtyRects[best];
+			rect.x0 = (r.x0 < rect.x0) ? r.x0 : rect.x0;
+			rect.y0 = (r.y0 < rect.y0) ? r.y0 : rect.y0;
+			rect.x1 = (r.x1 > rect.x1) ? r.x1 : rect.x1;
+			rect.y1 = (r.y1 > rect.y1) ? r.y1 : rect.y1;
+			_dirtyRects[best] = _dirtyRects[--_dirtyRectCount];
+			merged = true;
+		}
+	}
+	_dirtyRects[_dirtyRectCount++] = rect;
+}
+
+/*!
+	@brief Is a draw call to be recorded in the display list rather than drawn
+	@return true in tile mode, except while the list itself is being replayed
+*/
+bool ST7735_TFT_graphics::displayListActive(void)
+{
+	return _ramMode == TFTRAM_Tiles && _displayListReplay == false;
+}
+
+/*!
+	@brief Bytes one op takes in the display list
+	@param op TFT_DisplayOp_e
+	@param argc number of int16_t args
+	@return header + args + data pointer for ops that carry one
+*/
+uint16_t ST7735_TFT_graphics::displayOpLength(uint8_t op, uint8_t argc)
+{
+	return sizeof(DisplayOp_t) + argc * sizeof(int16_t) + ((op >= TFTOp_Icon) ? sizeof(const void *) : 0);
+}
+
+/*!
+	@brief Append a draw call to the display list, mark its tiles dirty and draw it into cached tiles
+	@param op which draw method
+	@param args the method's arguments
+	@param argc number of args, max 7
+	@param data bitmap or icon data for ops >= TFTOp_Icon, the pointer is stored not the data
+	@param x0 left of the area the call can change
+	@param y0 top of the area the call can change
+	@param x1 right of the area the call can change, inclusive
+	@param y1 bottom of the area the call can change, inclusive
+	@param opaque true if every pixel of the area is painted, hidden ops are then dropped
+*/
+void ST7735_TFT_graphics::displayListRecord(TFT_DisplayOp_e op, const int16_t *args, uint8_t argc, const void *data, int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool opaque)
+{
+	// 1. Clip to the screen, a call that draws nothing on screen is not kept
+	if (x0 < 0)
+		x0 = 0;
+	if (y0 < 0)
+		y0 = 0;
+	if (x1 >= _widthTFT)
+		x1 = _widthTFT - 1;
+	if (y1 >= _heightTFT)
+		y1 = _heightTFT - 1;
+	if (x0 > x1 || y0 > y1)
+		return;
+	DisplayOp_t header = {op, argc, (uint8_t)x0, (uint8_t)y0, (uint8_t)x1, (uint8_t)y1};
+
+	// 2. Drop earlier ops this one paints over completely, calls that went straight to the panel too
+	if (opaque)
+	{
+		const DirtyRect_t &lost = _displayListLost;
+		if (lost.x0 >= header.x0 && lost.x1 <= header.x1 && lost.y0 >= header.y0 && lost.y1 <= header.y1)
+			_displayListOverflow = false;
+		uint16_t read = 0, write = 0;
+		while (read < _displayListUsed)
+		{
+			DisplayOp_t earlier;
+			memcpy(&earlier, _displayList + read, sizeof(earlier));
+			uint16_t length = displayOpLength(earlier.op, earlier.argc);
+			if (earlier.x0 < header.x0 || earlier.x1 > header.x1 || earlier.y0 < header.y0 || earlier.y1 > header.y1)
+			{
+				if (write != read)
+					memmove(_displayList + write, _displayList + read, length);
+				write += length;
+			}
+			read += length;
+		}
+		_displayListUsed = write;
+	}
+
+	// 3. Append, with no room the call goes straight to the panel
+	uint16_t length = displayOpLength(op, argc);
+	if (_displayListUsed + length > _displayListSize)
+	{
+		printf("Error displayListRecord 1: Display list full, %u bytes, draw call sent to the panel\r\n", _displayListSize);
+		displayListOverflow(op, args, data, header.x0, header.y0, header.x1, header.y1);
+		return;
+	}
+	uint16_t start = _displayListUsed;
+	uint8_t *pos = _displayList + start;
+	memcpy(pos, &header, sizeof(header));
+	memcpy(pos + sizeof(header), args, argc * sizeof(int16_t));
+	if (op >= TFTOp_Icon)
+		memcpy(pos + sizeof(header) + argc * sizeof(int16_t), &data, sizeof(data));
+	_displayListUsed += length;
+
+	// 4. Mark the tiles it touches dirty and bring the cached ones up to date
+	uint8_t columns = (_widthTFT + _tileWidth - 1) / _tileWidth;
+	for (uint16_t row = y0 / _tileHeight; row <= y1 / _tileHeight; row++)
+	{
+		for (uint16_t column = x0 / _tileWidth; column <= x1 / _tileWidth; column++)
+		{
+			uint16_t tile = row * columns + column;
+			_dirtyTiles[tile / 32] |= 1u << (tile % 32);
+		}
+	}
+	for (uint8_t slot = 0; slot < _tileCount; slot++)
+	{
+		if (_tileSlots[slot].tile < 0)
+			continue;
+		tileTarget(slot);
+		displayListRender(start);
+	}
+	_ramTarget.buffer = nullptr;
+}
+
+/*!
+	@brief Draw a call that does not fit in the display list straight to the panel
+	@param op which draw method
+	@param args the method's arguments
+	@param data bitmap or icon data for ops >= TFTOp_Icon
+	@param x0 left of the area the call can change, on screen
+	@param y0 top of the area the call can change
+	@param x1 right of the area the call can change, inclusive
+	@param y1 bottom of the area the call can change, inclusive
+	@note The dirty tiles are sent first, so the call lands on top of what was recorded
+		before it and a later flush does not resend its area. Cached tiles get it too.
+		A tile re-rendered from the list would lose it, so TFTflush returns
+		Display_DisplayListFull until an opaque call covers the area or the list restarts.
+*/
+void ST7735_TFT_graphics::displayListOverflow(TFT_DisplayOp_e op, const int16_t *args, const void *data, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+	tileFlush();
+	_displayListReplay = true;
+	_ramTarget.buffer = nullptr;
+	displayOpDraw(op, args, data);
+	for (uint8_t slot = 0; slot < _tileCount; slot++)
+	{
+		if (_tileSlots[slot].tile < 0)
+			continue;
+		tileTarget(slot);
+		const RamTarget_t &target = _ramTarget;
+		if (x1 >= target.x && x0 < target.x + target.w && y1 >= target.y && y0 < target.y + target.h)
+			displayOpDraw(op, args, data);
+	}
+	_ramTarget.buffer = nullptr;
+	_displayListReplay = false;
+
+	DirtyRect_t &lost = _displayListLost;
+	if (_displayListOverflow == false)
+		lost = {x0, y0, x1, y1};
+	lost = {(x0 < lost.x0) ? x0 : lost.x0, (y0 < lost.y0) ? y0 : lost.y0,
+		(x1 > lost.x1) ? x1 : lost.x1, (y1 > lost.y1) ? y1 : lost.y1};
+	_displayListOverflow = true;
+}
+
+/*!
+	@brief Replay the display list into the RAM target
+	@param start byte offset of the first op to replay, 0 for the whole list
+	@note Ops whose bounds miss the target are skipped, the rest draw with their
+		normal method and are clipped to the target pixel by pixel.
+*/
+void ST7735_TFT_graphics::displayListRender(uint16_t start)
+{
+	const RamTarget_t &target = _ramTarget;
+	_displayListReplay = true;
+	while (start < _displayListUsed)
+	{
+		DisplayOp_t header;
+		memcpy(&header, _displayList + start, sizeof(header));
+		if (header.x1 >= target.x && header.x0 < target.x + target.w &&
+			header.y1 >= target.y && header.y0 < target.y + target.h)
+		{
+			int16_t args[TFT_DISPLAY_OP_ARGS_MAX];
+			const void *data = nullptr;
+			const uint8_t *pos = _displayList + start + sizeof(header);
+			memcpy(args, pos, header.argc * sizeof(int16_t));
+			if (header.op >= TFTOp_Icon)
+				memcpy(&data, pos + header.argc * sizeof(int16_t), sizeof(data));
+			displayOpDraw((TFT_DisplayOp_e)header.op, args, data);
+		}
+		start += displayOpLength(header.op, header.argc);
+	}
+	_displayListReplay = false;
+}
+
+/*!
+	@brief Draw one recorded op
+	@param op which draw method
+	@param args the method's arguments as recorded
+	@param data bitmap or icon data pointer, ops >= TFTOp_Icon
+	@note Text ops carry the font they were drawn in, the current font is restored after.
+*/
+void ST7735_TFT_graphics::displayOpDraw(TFT_DisplayOp_e op, const int16_t *args, const void *data)
+{
+	TFT_Font_Type_e font = (TFT_Font_Type_e)_FontNumber;
+	const TFT_PropFont_t *propFont = _propFont;
+	switch (op)
+	{
+	case TFTOp_Pixel:
+		TFTdrawPixel(args[0], args[1], args[2]);
+		break;
+	case TFTOp_FillRect:
+		fillRectSolid(args[0], args[1], args[2], args[3], args[4]);
+		break;
+	case TFTOp_Line:
+		TFTdrawLine(args[0], args[1], args[2], args[3], args[4]);
+		break;
+	case TFTOp_Circle:
+		TFTdrawCircle(args[0], args[1], args[2], args[3]);
+		break;
+	case TFTOp_FillCircle:
+		TFTfillCircle(args[0], args[1], args[2], args[3]);
+		break;
+	case TFTOp_RoundRect:
+		TFTdrawRoundRect(args[0], args[1], args[2], args[3], args[4], args[5]);
+		break;
+	case TFTOp_FillRoundRect:
+		TFTfillRoundRect(args[0], args[1], args[2], args[3], args[4], args[5]);
+		break;
+	case TFTOp_Triangle:
+		TFTdrawTriangle(args[0], args[1], args[2], args[3], args[4], args[5], args[6]);
+		break;
+	case TFTOp_FillTriangle:
+		TFTfillTriangle(args[0], args[1], args[2], args[3], args[4], args[5], args[6]);
+		break;
+	case TFTOp_Ellipse:
+		TFTdrawEllipse(args[0], args[1], args[2], args[3], args[4]);
+		break;
+	case TFTOp_FillEllipse:
+		TFTfillEllipse(args[0], args[1], args[2], args[3], args[4]);
+		break;
+	case TFTOp_Arc:
+		TFTdrawArc(args[0], args[1], args[2], args[3], args[4], args[5]);
+		break;
+	case TFTOp_FillArc:
+		TFTfillArc(args[0], args[1], args[2], args[3], args[4], args[5], args[6]);
+		break;
+	case TFTOp_LineAA:
+		TFTdrawLineAA(args[0], args[1], args[2], args[3], args[4], args[5]);
+		break;
+	case TFTOp_CircleAA:
+		TFTdrawCircleAA(args[0], args[1], args[2], args[3], args[4]);
+		break;
+	case TFTOp_FillCircleAA:
+		TFTfillCircleAA(args[0], args[1], args[2], args[3], args[4]);
+		break;
+	case TFTOp_Char:
+		TFTFontNum((TFT_Font_Type_e)args[6]);
+		TFTdrawChar(args[0], args[1], args[2], args[3], args[4], args[5]);
+		TFTFontNum(font);
+		break;
+	case TFTOp_CharBig:
+		TFTFontNum((TFT_Font_Type_e)args[5]);
+		TFTdrawChar(args[0], args[1], args[2], args[3], args[4]);
+		TFTFontNum(font);
+		break;
+	case TFTOp_Icon:
+		TFTdrawIcon(args[0], args[1], args[2], args[3], args[4], (const unsigned char *)data);
+		break;
+	case TFTOp_Bitmap:
+		TFTdrawBitmap(args[0], args[1], args[2], args[3], args[4], args[5], (uint8_t *)data, args[6]);
+		break;
+	case TFTOp_Bitmap16:
+		TFTdrawBitmap16Data(args[0], args[1], (uint8_t *)data, args[2], args[3]);
+		break;
+	case TFTOp_Bitmap565:
+		TFTdrawBitmap565Data(args[0], args[1], (const uint16_t *)data, args[2], args[3]);
+		break;
+	case TFTOp_Bitmap24:
+		TFTdrawBitmap24Data(args[0], args[1], (uint8_t *)data, args[2], args[3]);
+		break;
+	case TFTOp_Sprite:
+		TFTdrawSpriteData(args[0], args[1], (uint8_t *)data, args[2], args[3], args[4]);
+		break;
+	case TFTOp_Polygon:
+		TFTfillPolygon((const int16_t *)data, args[0], args[1], (TFT_Fill_rule_e)args[2], args[3]);
+		break;
+	case TFTOp_PolygonAA:
+		TFTfillPolygonAA((const int16_t *)data, args[0], args[1], args[2], (TFT_Fill_rule_e)args[3], args[4]);
+		break;
+	case TFTOp_TextProp:
+	{
+		char text[TFT_TEXT_RUN_MAX];
+		for (uint8_t i = 0; i < args[4]; i++)
+			text[i] = (args[5 + i / 2] >> ((i & 1) * 8)) & 0xFF;
+		_propFont = (const TFT_PropFont_t *)data;
+		propTextDraw(args[0], args[1], text, args[4], args[2], args[3]);
+		break;
+	}
+	}
+	_propFont = propFont;
+}
+
+/*!
+	@brief Called by TFTsetRotation after the screen width and height change
+	@note The framebuffer takes the new layout. In tile mode the recorded calls and
+		cached tiles are in the old coordinates, the list starts again empty.
+*/
+void ST7735_TFT_graphics::ramModeRotated(void)
+{
+	if (_ramMode == TFTRAM_FrameBuffer)
+		_ramTarget = {_frameBuffer, 0, 0, (uint8_t)_widthTFT, (uint8_t)_heightTFT, _frameBufferBits};
+	if (_shadowBuffer != nullptr)
+	{
+		_shadowValid = false;
+		frameBufferMarkDirty(0, 0, _widthTFT - 1, _heightTFT - 1);
+	}
+	for (uint8_t slot = 0; slot < _tileCount; slot++)
+		_tileSlots[slot] = {-1, 0};
+	memset(_dirtyTiles, 0, sizeof(_dirtyTiles));
+	_displayListUsed = 0;
+	_displayListOverflow = false;
 }
 
 /*!
@@ -1375,6 +4558,7 @@ void ST7735_TFT_graphics::TFTsetCursor(int16_t x, int16_t y)
 {
 	_cursorX = x;
 	_cursorY = y;
+	_kernLeft = 0;
 }
 
 /*!
@@ -1436,6 +4620,12 @@ Display_Return_Codes_e  ST7735_TFT_graphics::TFTdrawSpriteData(uint8_t x, uint8_
 		printf("Error TFTdrawSprite 2: Sprite out of screen bounds\r\n");
 		return Display_BitmapScreenBounds;
 	}
+	if (displayListActive())
+	{
+		int16_t args[] = {x, y, w, h, (int16_t)backgroundColor};
+		displayListRecord(TFTOp_Sprite, args, 5, pBmp, x - 1, y - 1, x + w - 2, y + h - 2, false);
+		return Display_Success;
+	}
 	if ((x + w - 1) >= _widthTFT)
 		w = _widthTFT - x;
 	if ((y + h - 1) >= _heightTFT)